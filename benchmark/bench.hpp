@@ -0,0 +1,54 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_BENCHMARK_BENCH_HPP
+#define STL2_BENCHMARK_BENCH_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace bench {
+	// Keep the optimizer from discarding the computation of x.
+	template<class T>
+	inline void do_not_optimize(const T& x) {
+		asm volatile("" : : "r,m"(x) : "memory");
+	}
+
+	// Best-of-five average nanoseconds per call of f over iterations calls.
+	template<class F>
+	double time_ns(std::size_t iterations, F f) {
+		using clock = std::chrono::steady_clock;
+		double best = 0;
+		for (int run = 0; run < 5; ++run) {
+			const auto start = clock::now();
+			for (std::size_t i = 0; i < iterations; ++i) {
+				f();
+			}
+			const std::chrono::duration<double, std::nano> elapsed = clock::now() - start;
+			const double ns = elapsed.count() / iterations;
+			if (run == 0 || ns < best) best = ns;
+		}
+		return best;
+	}
+
+	inline void report(const char* name, std::size_t n, double baseline, double ns) {
+		std::printf("%-28s n=%-8zu %12.1f ns %12.1f ns %8.2fx\n",
+			name, n, baseline, ns, baseline / ns);
+	}
+
+	inline void header() {
+		std::printf("%-28s %-10s %15s %15s %9s\n",
+			"benchmark", "", "baseline", "stl2", "speedup");
+	}
+}
+
+#endif
@@ -0,0 +1,63 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Compares ranges::find over contiguous integer ranges with the scalar loop
+// it replaces. The needle sits in the last element, so each call scans the
+// whole range.
+//
+#include <stl2/algorithm.hpp>
+#include <cstdint>
+#include <vector>
+#include "bench.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	template<class T>
+	const T* scalar_find(const T* first, const T* last, const T& value) {
+		for (; first != last; ++first) {
+			if (*first == value) break;
+		}
+		return first;
+	}
+
+	template<class T>
+	void run(const char* name, std::size_t n) {
+		std::vector<T> v(n, T(1));
+		v.back() = T(2);
+		const std::size_t iterations = 1 + (std::size_t{1} << 26) / n;
+
+		const double scalar = bench::time_ns(iterations, [&] {
+			bench::do_not_optimize(v.data());
+			bench::do_not_optimize(scalar_find(v.data(), v.data() + n, T(2)));
+		});
+		const double stl2 = bench::time_ns(iterations, [&] {
+			bench::do_not_optimize(v.data());
+			bench::do_not_optimize(ranges::find(v, T(2)));
+		});
+		bench::report(name, n, scalar, stl2);
+	}
+
+	template<class T>
+	void run_sizes(const char* name) {
+		for (std::size_t n : {16u, 256u, 4096u, 65536u, 1048576u}) {
+			run<T>(name, n);
+		}
+	}
+}
+
+int main() {
+	bench::header();
+	run_sizes<std::uint8_t>("find<uint8_t>");
+	run_sizes<std::uint16_t>("find<uint16_t>");
+	run_sizes<std::uint32_t>("find<uint32_t>");
+	run_sizes<std::uint64_t>("find<uint64_t>");
+}
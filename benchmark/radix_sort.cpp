@@ -0,0 +1,86 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Compares ext::radix_sort and ext::stable_radix_sort with ranges::sort and
+// ranges::stable_sort, on random keys and on records sorted by a key member.
+//
+#include <stl2/algorithm.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "bench.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	struct record {
+		std::uint32_t key;
+		std::uint32_t payload;
+	};
+
+	template<class T, class Proj>
+	void run(const char* type, std::size_t n, Proj proj) {
+		constexpr std::size_t inputs = 4;
+		std::mt19937_64 gen{42};
+		std::vector<std::vector<T>> input(inputs, std::vector<T>(n));
+		for (auto& in : input) {
+			for (auto& x : in) {
+				if constexpr (std::is_floating_point_v<T>) {
+					x = std::uniform_real_distribution<T>{-1e9, 1e9}(gen);
+				} else if constexpr (std::is_arithmetic_v<T>) {
+					x = static_cast<T>(gen());
+				} else {
+					x = T{static_cast<std::uint32_t>(gen()), 0};
+				}
+			}
+		}
+		std::vector<T> v;
+		std::size_t i = 0;
+		char name[64];
+
+		std::snprintf(name, sizeof(name), "radix_sort %s", type);
+		const double sort = bench::time_ns(inputs, [&] {
+			v = input[i++ % inputs];
+			ranges::sort(v, ranges::less{}, proj);
+			bench::do_not_optimize(v.data());
+		});
+		const double radix = bench::time_ns(inputs, [&] {
+			v = input[i++ % inputs];
+			ranges::ext::radix_sort(v, proj);
+			bench::do_not_optimize(v.data());
+		});
+		bench::report(name, n, sort, radix);
+
+		std::snprintf(name, sizeof(name), "stable_radix_sort %s", type);
+		const double stable = bench::time_ns(inputs, [&] {
+			v = input[i++ % inputs];
+			ranges::stable_sort(v, ranges::less{}, proj);
+			bench::do_not_optimize(v.data());
+		});
+		const double stable_radix = bench::time_ns(inputs, [&] {
+			v = input[i++ % inputs];
+			ranges::ext::stable_radix_sort(v, proj);
+			bench::do_not_optimize(v.data());
+		});
+		bench::report(name, n, stable, stable_radix);
+	}
+}
+
+int main() {
+	bench::header();
+	for (std::size_t n : {1000u, 100000u, 1000000u, 10000000u}) {
+		run<std::uint32_t>("uint32", n, ranges::identity{});
+		run<std::int64_t>("int64", n, ranges::identity{});
+		run<double>("double", n, ranges::identity{});
+		run<record>("record", n, &record::key);
+	}
+}
@@ -0,0 +1,80 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Compares ext::reduce, ext::accumulate and ext::transform_reduce over
+// contiguous arithmetic ranges with std::accumulate and std::inner_product.
+//
+#include <stl2/numeric.hpp>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+#include "bench.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	template<class T, class F, class G>
+	void compare(const char* name, std::size_t n, F baseline, G stl2) {
+		const std::size_t iterations = 1 + (std::size_t{1} << 26) / n;
+		bench::report(name, n, bench::time_ns(iterations, baseline),
+			bench::time_ns(iterations, stl2));
+	}
+
+	template<class T>
+	void run(const char* type, std::size_t n) {
+		std::vector<T> v(n, T(1)), w(n, T(2));
+		char name[64];
+
+		std::snprintf(name, sizeof(name), "reduce<%s>", type);
+		compare<T>(name, n, [&] {
+			bench::do_not_optimize(v.data());
+			bench::do_not_optimize(std::accumulate(v.begin(), v.end(), T(0)));
+		}, [&] {
+			bench::do_not_optimize(v.data());
+			bench::do_not_optimize(ranges::ext::reduce(v, T(0)));
+		});
+
+		if constexpr (std::is_integral_v<T>) {
+			std::snprintf(name, sizeof(name), "accumulate<%s>", type);
+			compare<T>(name, n, [&] {
+				bench::do_not_optimize(v.data());
+				bench::do_not_optimize(std::accumulate(v.begin(), v.end(), T(0)));
+			}, [&] {
+				bench::do_not_optimize(v.data());
+				bench::do_not_optimize(ranges::ext::accumulate(v, T(0)));
+			});
+		}
+
+		std::snprintf(name, sizeof(name), "transform_reduce<%s>", type);
+		compare<T>(name, n, [&] {
+			bench::do_not_optimize(v.data());
+			bench::do_not_optimize(std::inner_product(v.begin(), v.end(), w.begin(), T(0)));
+		}, [&] {
+			bench::do_not_optimize(v.data());
+			bench::do_not_optimize(ranges::ext::transform_reduce(v, w, T(0)));
+		});
+	}
+
+	template<class T>
+	void run_sizes(const char* type) {
+		for (std::size_t n : {256u, 4096u, 65536u, 1048576u}) {
+			run<T>(type, n);
+		}
+	}
+}
+
+int main() {
+	bench::header();
+	run_sizes<std::int32_t>("int32_t");
+	run_sizes<std::int64_t>("int64_t");
+	run_sizes<float>("float");
+	run_sizes<double>("double");
+}
@@ -0,0 +1,104 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Compares ext::inclusive_scan, ext::exclusive_scan and
+// ext::adjacent_difference over contiguous arithmetic ranges with
+// std::partial_sum and std::adjacent_difference, and inclusive_scan under
+// ext::par with the sequential version.
+//
+#include <stl2/numeric.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+#include "bench.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	template<class F, class G>
+	void compare(const char* name, std::size_t n, F baseline, G stl2) {
+		const std::size_t iterations = 1 + (std::size_t{1} << 26) / n;
+		bench::report(name, n, bench::time_ns(iterations, baseline),
+			bench::time_ns(iterations, stl2));
+	}
+
+	template<class T>
+	void run(const char* type, std::size_t n) {
+		std::vector<T> v(n, T(1)), out(n);
+		char name[64];
+
+		std::snprintf(name, sizeof(name), "inclusive_scan<%s>", type);
+		compare(name, n, [&] {
+			bench::do_not_optimize(v.data());
+			std::partial_sum(v.begin(), v.end(), out.begin());
+			bench::do_not_optimize(out.data());
+		}, [&] {
+			bench::do_not_optimize(v.data());
+			ranges::ext::inclusive_scan(v, out.begin());
+			bench::do_not_optimize(out.data());
+		});
+
+		std::snprintf(name, sizeof(name), "exclusive_scan<%s>", type);
+		compare(name, n, [&] {
+			bench::do_not_optimize(v.data());
+			T acc{};
+			for (std::size_t i = 0; i < n; ++i) {
+				out[i] = acc;
+				acc += v[i];
+			}
+			bench::do_not_optimize(out.data());
+		}, [&] {
+			bench::do_not_optimize(v.data());
+			ranges::ext::exclusive_scan(v, out.begin(), T{});
+			bench::do_not_optimize(out.data());
+		});
+
+		std::snprintf(name, sizeof(name), "adjacent_difference<%s>", type);
+		compare(name, n, [&] {
+			bench::do_not_optimize(v.data());
+			std::adjacent_difference(v.begin(), v.end(), v.begin());
+			bench::do_not_optimize(v.data());
+		}, [&] {
+			bench::do_not_optimize(v.data());
+			ranges::ext::adjacent_difference(v, v.begin());
+			bench::do_not_optimize(v.data());
+		});
+
+		if (n >= 65536) {
+			std::snprintf(name, sizeof(name), "par inclusive_scan<%s>", type);
+			compare(name, n, [&] {
+				bench::do_not_optimize(v.data());
+				ranges::ext::inclusive_scan(v, out.begin());
+				bench::do_not_optimize(out.data());
+			}, [&] {
+				bench::do_not_optimize(v.data());
+				ranges::ext::inclusive_scan(ranges::ext::par, v, out.begin());
+				bench::do_not_optimize(out.data());
+			});
+		}
+	}
+
+	template<class T>
+	void run_sizes(const char* type) {
+		for (std::size_t n : {256u, 4096u, 65536u, 1048576u, 16777216u}) {
+			run<T>(type, n);
+		}
+	}
+}
+
+int main() {
+	bench::header();
+	run_sizes<std::int32_t>("int32_t");
+	run_sizes<std::int64_t>("int64_t");
+	run_sizes<float>("float");
+	run_sizes<double>("double");
+}
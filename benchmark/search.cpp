@@ -0,0 +1,63 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Compares the searchers with the naive matcher that ranges::search uses for
+// non-byte ranges, on text-like and on highly repetitive haystacks.
+//
+#include <stl2/algorithm.hpp>
+#include <cstdio>
+#include <list>
+#include <random>
+#include <string>
+#include "bench.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	template<class Searcher>
+	void run(const char* name, const std::string& hay, const Searcher& searcher, double baseline) {
+		const double ns = bench::time_ns(20, [&] {
+			bench::do_not_optimize(hay.data());
+			bench::do_not_optimize(ranges::search(hay, searcher).begin());
+		});
+		bench::report(name, hay.size(), baseline, ns);
+	}
+
+	void run_all(const char* title, const std::string& hay, const std::string& needle) {
+		std::printf("%s\n", title);
+		// A predicate other than equal_to gets the naive matcher.
+		const double naive = bench::time_ns(20, [&] {
+			bench::do_not_optimize(hay.data());
+			bench::do_not_optimize(ranges::search(hay, needle,
+				[](char a, char b) { return a == b; }).begin());
+		});
+		run("boyer_moore_horspool", hay,
+			ranges::ext::boyer_moore_horspool_searcher{needle.begin(), needle.end()}, naive);
+		run("two_way", hay, ranges::ext::two_way_searcher{needle.begin(), needle.end()}, naive);
+		run("byte", hay, ranges::ext::byte_searcher{needle.begin(), needle.end()}, naive);
+	}
+}
+
+int main() {
+	constexpr std::size_t n = 1 << 22;
+	std::mt19937 gen{42};
+	std::uniform_int_distribution<int> letters{'a', 'z'};
+	std::string text(n, ' ');
+	for (auto& c : text) c = static_cast<char>(letters(gen));
+	const std::string needle = "the quick brown fox jumps over the lazy dog";
+	bench::header();
+	run_all("random text, 43-byte needle:", text, needle);
+
+	std::string repetitive(n, 'a');
+	std::string periodic(64, 'a');
+	periodic.back() = 'b';
+	run_all("aaaa...a haystack, aaa...ab needle:", repetitive, periodic);
+}
@@ -0,0 +1,78 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Compares ranges::sort with std::sort - a median-of-3 introsort, like the
+// one ranges::sort used to be - on random keys and on common patterns.
+//
+#include <stl2/algorithm.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "bench.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	// Each timed call sorts the next of several inputs, lest the branch
+	// predictor learn a single input by heart.
+	template<class T, class Fill>
+	void run(const char* name, std::size_t n, Fill fill) {
+		constexpr std::size_t inputs = 16;
+		std::vector<std::vector<T>> input(inputs, std::vector<T>(n));
+		for (auto& in : input) fill(in);
+		std::vector<T> v;
+		std::size_t i = 0;
+		const double baseline = bench::time_ns(inputs, [&] {
+			v = input[i++ % inputs];
+			std::sort(v.begin(), v.end());
+			bench::do_not_optimize(v.data());
+		});
+		const double stl2 = bench::time_ns(inputs, [&] {
+			v = input[i++ % inputs];
+			ranges::sort(v);
+			bench::do_not_optimize(v.data());
+		});
+		bench::report(name, n, baseline, stl2);
+	}
+
+	template<class T>
+	void run_patterns(const char* type, std::size_t n) {
+		std::mt19937 gen{42};
+		char name[64];
+		std::snprintf(name, sizeof(name), "random %s", type);
+		run<T>(name, n, [&](auto& v) {
+			std::uniform_int_distribution<int> dist;
+			for (auto& x : v) x = static_cast<T>(dist(gen));
+		});
+		std::snprintf(name, sizeof(name), "sorted %s", type);
+		run<T>(name, n, [&](auto& v) {
+			for (std::size_t i = 0; i < v.size(); ++i) v[i] = static_cast<T>(i);
+		});
+		std::snprintf(name, sizeof(name), "reversed %s", type);
+		run<T>(name, n, [&](auto& v) {
+			for (std::size_t i = 0; i < v.size(); ++i) v[i] = static_cast<T>(v.size() - i);
+		});
+		std::snprintf(name, sizeof(name), "few unique %s", type);
+		run<T>(name, n, [&](auto& v) {
+			std::uniform_int_distribution<int> dist{0, 15};
+			for (auto& x : v) x = static_cast<T>(dist(gen));
+		});
+	}
+}
+
+int main() {
+	bench::header();
+	for (std::size_t n : {1000u, 1000000u}) {
+		run_patterns<int>("int", n);
+		run_patterns<double>("double", n);
+	}
+}
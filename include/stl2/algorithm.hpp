@@ -27,6 +27,7 @@
 #include <stl2/detail/algorithm/count_if.hpp>
 #include <stl2/detail/algorithm/equal.hpp>
 #include <stl2/detail/algorithm/equal_range.hpp>
+#include <stl2/detail/algorithm/eytzinger_index.hpp>
 #include <stl2/detail/algorithm/fill.hpp>
 #include <stl2/detail/algorithm/fill_n.hpp>
 #include <stl2/detail/algorithm/find.hpp>
@@ -69,6 +70,7 @@
 #include <stl2/detail/algorithm/pop_heap.hpp>
 #include <stl2/detail/algorithm/prev_permutation.hpp>
 #include <stl2/detail/algorithm/push_heap.hpp>
+#include <stl2/detail/algorithm/radix_sort.hpp>
 #include <stl2/detail/algorithm/remove.hpp>
 #include <stl2/detail/algorithm/remove_copy.hpp>
 #include <stl2/detail/algorithm/remove_copy_if.hpp>
@@ -83,6 +85,7 @@
 #include <stl2/detail/algorithm/rotate_copy.hpp>
 #include <stl2/detail/algorithm/search.hpp>
 #include <stl2/detail/algorithm/search_n.hpp>
+#include <stl2/detail/algorithm/searchers.hpp>
 #include <stl2/detail/algorithm/set_difference.hpp>
 #include <stl2/detail/algorithm/set_intersection.hpp>
 #include <stl2/detail/algorithm/set_symmetric_difference.hpp>
@@ -14,7 +14,9 @@
 #ifndef STL2_DETAIL_ALGORITHM_ANY_OF_HPP
 #define STL2_DETAIL_ALGORITHM_ANY_OF_HPP
 
+#include <stl2/detail/algorithm/find_if.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution.hpp>
 #include <stl2/detail/range/concepts.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -38,6 +40,33 @@ STL2_OPEN_NAMESPACE {
 		constexpr bool operator()(R&& rng, Pred pred, Proj proj = {}) const {
 			return (*this)(begin(rng), end(rng), __stl2::ref(pred), __stl2::ref(proj));
 		}
+
+		// Extension: execution policies. Threads stop searching once any
+		// has found an element that satisfies pred.
+		template<ext::ExecutionPolicy EP, RandomAccessIterator I, SizedSentinel<I> S,
+			class Proj = identity, IndirectUnaryPredicate<projected<I, Proj>> Pred>
+		bool operator()(EP&& policy, I first, S last, Pred pred, Proj proj = {}) const {
+			using D = iter_difference_t<I>;
+			const auto n = D(last - first);
+			if constexpr (detail::__parallel_policy<EP>) {
+				return detail::parallel_find<false>(policy.pool(), n,
+					D(detail::__parallel_grain), [&](D b, D e) {
+						return D(__stl2::find_if(first + b, first + e, __stl2::ref(pred),
+							__stl2::ref(proj)) - first);
+					}) != n;
+			} else {
+				auto stop = first + n;
+				return (*this)(std::move(first), std::move(stop), __stl2::ref(pred),
+					__stl2::ref(proj));
+			}
+		}
+
+		template<ext::ExecutionPolicy EP, detail::__parallel_range R, class Proj = identity,
+			IndirectUnaryPredicate<projected<iterator_t<R>, Proj>> Pred>
+		bool operator()(EP&& policy, R&& rng, Pred pred, Proj proj = {}) const {
+			return (*this)(std::forward<EP>(policy), begin(rng), end(rng),
+				__stl2::ref(pred), __stl2::ref(proj));
+		}
 	};
 
 	inline constexpr __any_of_fn any_of {};
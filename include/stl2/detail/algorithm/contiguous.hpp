@@ -0,0 +1,548 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_CONTIGUOUS_HPP
+#define STL2_DETAIL_ALGORITHM_CONTIGUOUS_HPP
+
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/simd.hpp>
+#include <stl2/detail/concepts/core.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/iterator/counted_iterator.hpp>
+#include <stl2/detail/iterator/move_iterator.hpp>
+#include <stl2/detail/iterator/reverse_iterator.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Contiguous fast paths [Extension]
+//
+// Lets algorithms recognize iterators that denote contiguous storage -
+// possibly hidden behind counted_iterator, move_iterator, and
+// reverse_iterator adaptors - and process that storage in bulk.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// __unwrap<I> peels the adaptors off of I that do not change which
+		// object an iterator denotes. base(i) yields the innermost iterator,
+		// reversed says whether walking forward through I walks backward
+		// through that innermost iterator, and advance(i, n) is an O(1)
+		// equivalent of __stl2::advance(i, n) for any I whose innermost
+		// iterator is random access.
+		template<class I>
+		struct __unwrap {
+			using type = I;
+			static constexpr bool reversed = false;
+
+			static constexpr I base(const I& i) {
+				return i;
+			}
+			static constexpr void advance(I& i, iter_difference_t<I> n) {
+				i += n;
+			}
+		};
+
+		template<class I>
+		struct __unwrap<counted_iterator<I>> {
+			using type = typename __unwrap<I>::type;
+			static constexpr bool reversed = __unwrap<I>::reversed;
+
+			static constexpr type base(const counted_iterator<I>& i) {
+				return __unwrap<I>::base(i.base());
+			}
+			static constexpr void
+			advance(counted_iterator<I>& i, iter_difference_t<I> n) {
+				STL2_EXPECT(n <= i.count());
+				auto tmp = i.base();
+				__unwrap<I>::advance(tmp, n);
+				i = counted_iterator<I>{std::move(tmp), i.count() - n};
+			}
+		};
+
+		template<class I>
+		struct __unwrap<basic_iterator<__move_iterator::cursor<I>>> {
+			using type = typename __unwrap<I>::type;
+			static constexpr bool reversed = __unwrap<I>::reversed;
+
+			static constexpr type base(const move_iterator<I>& i) {
+				return __unwrap<I>::base(i.base());
+			}
+			static constexpr void
+			advance(move_iterator<I>& i, iter_difference_t<I> n) {
+				auto tmp = i.base();
+				__unwrap<I>::advance(tmp, n);
+				i = __stl2::make_move_iterator(std::move(tmp));
+			}
+		};
+
+		template<class I>
+		struct __unwrap<basic_iterator<__reverse_iterator::cursor<I>>> {
+			using type = typename __unwrap<I>::type;
+			static constexpr bool reversed = !__unwrap<I>::reversed;
+
+			static constexpr type base(const reverse_iterator<I>& i) {
+				return __unwrap<I>::base(i.base());
+			}
+			static constexpr void
+			advance(reverse_iterator<I>& i, iter_difference_t<I> n) {
+				auto tmp = i.base();
+				__unwrap<I>::advance(tmp, -n);
+				i = __stl2::make_reverse_iterator(std::move(tmp));
+			}
+		};
+
+		template<class I>
+		using __unwrap_t = typename __unwrap<I>::type;
+
+		// I denotes the elements of an array of objects with no hidden
+		// state, so they can be read or written as raw bytes.
+		template<class I>
+		META_CONCEPT __raw_iterator =
+			ContiguousIterator<__unwrap_t<I>> &&
+			std::is_trivially_copyable_v<iter_value_t<__unwrap_t<I>>> &&
+			!std::is_volatile_v<std::remove_reference_t<
+				iter_reference_t<__unwrap_t<I>>>>;
+
+		// Assigning From to the elements of O, where From is what the
+		// algorithm reads from the elements of I, is equivalent to memmove.
+		template<class I, class O, class From>
+		META_CONCEPT __memmovable =
+			__raw_iterator<I> && __raw_iterator<O> &&
+			__unwrap<I>::reversed == __unwrap<O>::reversed &&
+			Same<iter_value_t<__unwrap_t<I>>, iter_value_t<__unwrap_t<O>>> &&
+			std::is_trivially_assignable_v<iter_reference_t<O>, From>;
+
+		template<class I, class O>
+		META_CONCEPT MemCopyable =
+			__memmovable<I, O, iter_reference_t<I>>;
+
+		template<class I, class O>
+		META_CONCEPT MemMovable =
+			__memmovable<I, O, iter_rvalue_reference_t<I>>;
+
+		// Address of the lowest of the n > 0 elements visited by walking
+		// forward - or backward, if Backward - from i.
+		template<bool Backward, __raw_iterator I>
+		auto __lowest_address(const I& i, iter_difference_t<I> n) {
+			STL2_EXPECT(n > 0);
+			auto base = __unwrap<I>::base(i);
+			if constexpr (__unwrap<I>::reversed != Backward) {
+				return std::addressof(*(base - n));
+			} else {
+				return std::addressof(*base);
+			}
+		}
+
+		// Copy the n elements starting at first to the n elements starting
+		// at result as if by memmove, and advance both past them.
+		template<class I, class O>
+		requires __memmovable<I, O, iter_reference_t<I>> ||
+			__memmovable<I, O, iter_rvalue_reference_t<I>>
+		void __memmove_forward(I& first, iter_difference_t<I> n, O& result) {
+			if (n <= 0) return;
+			std::memmove(
+				__lowest_address<false>(result, static_cast<iter_difference_t<O>>(n)),
+				__lowest_address<false>(first, n),
+				static_cast<std::size_t>(n) * sizeof(iter_value_t<__unwrap_t<I>>));
+			__unwrap<I>::advance(first, n);
+			__unwrap<O>::advance(result, static_cast<iter_difference_t<O>>(n));
+		}
+
+		// Copy the n elements ending at last to the n elements ending at
+		// result as if by memmove, and retreat result before them.
+		template<class I, class O>
+		requires __memmovable<I, O, iter_reference_t<I>> ||
+			__memmovable<I, O, iter_rvalue_reference_t<I>>
+		void __memmove_backward(const I& last, iter_difference_t<I> n, O& result) {
+			if (n <= 0) return;
+			std::memmove(
+				__lowest_address<true>(result, static_cast<iter_difference_t<O>>(n)),
+				__lowest_address<true>(last, n),
+				static_cast<std::size_t>(n) * sizeof(iter_value_t<__unwrap_t<I>>));
+			__unwrap<O>::advance(result, -static_cast<iter_difference_t<O>>(n));
+		}
+
+		// I visits every stride()-th element of an array like stride_view's
+		// iterators do: base() is the position in the array, which is
+		// walked forward.
+		template<class I>
+		META_CONCEPT __strided_raw_iterator =
+			RandomAccessIterator<I> &&
+			requires(const I& i) {
+				i.base();
+				{ i.stride() } -> Same<iter_difference_t<I>>&&;
+			} &&
+			__raw_iterator<decltype(std::declval<const I&>().base())> &&
+			!__unwrap<decltype(std::declval<const I&>().base())>::reversed;
+
+		template<class I, class O>
+		META_CONCEPT StridedCopyable =
+			__strided_raw_iterator<I> && IndirectlyCopyable<I, O>;
+
+		// Copy the n elements starting at first to the n elements starting
+		// at result with an indexed gather loop - unrolled, and into raw
+		// storage when result denotes an array - and advance both past them.
+		template<class I, class O>
+		requires StridedCopyable<I, O>
+		void __gather_forward(I& first, iter_difference_t<I> n, O& result) {
+			if (n <= 0) return;
+			using B = decltype(first.base());
+			const auto src = std::addressof(*__unwrap<B>::base(first.base()));
+			const auto k = static_cast<std::ptrdiff_t>(first.stride());
+			const auto m = static_cast<std::ptrdiff_t>(n);
+			if constexpr (__raw_iterator<O> && !__unwrap<O>::reversed &&
+				std::is_trivially_assignable_v<iter_reference_t<O>, iter_reference_t<I>>)
+			{
+				const auto dst = std::addressof(*__unwrap<O>::base(result));
+				std::ptrdiff_t i = 0;
+				for (; m - i >= 4; i += 4) {
+					dst[i] = src[i * k];
+					dst[i + 1] = src[(i + 1) * k];
+					dst[i + 2] = src[(i + 2) * k];
+					dst[i + 3] = src[(i + 3) * k];
+				}
+				for (; i < m; ++i) {
+					dst[i] = src[i * k];
+				}
+				__unwrap<O>::advance(result, static_cast<iter_difference_t<O>>(n));
+			} else {
+				for (std::ptrdiff_t i = 0; i < m; ++i, (void) ++result) {
+					*result = src[i * k];
+				}
+			}
+			first += n;
+		}
+
+		// Writing a const T& to an element of O stores the same bytes as
+		// copying a single value of O's value type converted from it.
+		template<class O, class T>
+		META_CONCEPT __fill_value = __raw_iterator<O> &&
+			(Same<__uncvref<T>, iter_value_t<__unwrap_t<O>>> ||
+				(std::is_arithmetic_v<__uncvref<T>> &&
+					std::is_arithmetic_v<iter_value_t<__unwrap_t<O>>>));
+
+		template<class O, class T>
+		META_CONCEPT MemFillable = __fill_value<O, T> &&
+			std::is_trivially_assignable_v<iter_reference_t<O>, const T&>;
+
+		// Store the bytes of value into each of the n objects at p: with
+		// memset when those bytes are all the same - which covers every
+		// single-byte type and zero-filling of integers - and otherwise with
+		// vector stores of the repeated pattern.
+		template<class T>
+		void __fill_bytes(T* p, std::size_t n, const T& value) noexcept {
+			unsigned char bytes[sizeof(T)];
+			std::memcpy(bytes, std::addressof(value), sizeof(T));
+			bool uniform = true;
+			for (std::size_t i = 1; i < sizeof(T); ++i) {
+				uniform = uniform && bytes[i] == bytes[0];
+			}
+			if (uniform) {
+				std::memset(p, bytes[0], n * sizeof(T));
+			} else if constexpr (requires { typename simd::bits_t<sizeof(T)>; }) {
+				simd::fill(p, n, value);
+			} else {
+				for (std::size_t i = 0; i < n; ++i) {
+					std::memcpy(p + i, bytes, sizeof(T));
+				}
+			}
+		}
+
+		// Store V(value) - where V is the value type of O - into the n
+		// elements starting at first, and advance first past them.
+		template<class O, class T>
+		requires __fill_value<O, T>
+		void __memset_forward(O& first, iter_difference_t<O> n, const T& value) {
+			if (n <= 0) return;
+			using V = iter_value_t<__unwrap_t<O>>;
+			const V v = static_cast<V>(value);
+			// The uninitialized algorithms construct through iterators to const.
+			const auto p = const_cast<V*>(__lowest_address<false>(first, n));
+			detail::__fill_bytes(p, static_cast<std::size_t>(n), v);
+			__unwrap<O>::advance(first, n);
+		}
+
+		// Proj is identity, possibly behind a reference_wrapper.
+		template<class Proj>
+		META_CONCEPT __identity_projection =
+			Same<__uncvref<__stl2::__unwrap<Proj>>, identity>;
+
+		// Comparing the elements of I to a const T& with == can be done by
+		// comparing their bytes with the bytes of a single converted value.
+		template<class I, class T, class Proj>
+		META_CONCEPT MemSearchable =
+			__raw_iterator<I> && !__unwrap<I>::reversed &&
+			__identity_projection<Proj> &&
+			simd::__searchable<iter_value_t<__unwrap_t<I>>> &&
+			std::is_integral_v<__uncvref<T>>;
+
+		// The first of the n elements starting at first that equals value,
+		// or first + n if there is no such element.
+		template<class I, class T>
+		requires MemSearchable<I, T, identity>
+		I __memchr_forward(I first, iter_difference_t<I> n, const T& value) {
+			using V = iter_value_t<__unwrap_t<I>>;
+			const V v = static_cast<V>(value);
+			// Spell out the usual arithmetic conversions that == performs.
+			using C = std::common_type_t<V, __uncvref<T>>;
+			if (n <= 0 || static_cast<C>(v) != static_cast<C>(value)) {
+				// No V compares equal to value.
+				__unwrap<I>::advance(first, n > 0 ? n : 0);
+				return first;
+			}
+			const auto p = __lowest_address<false>(first, n);
+			const V* const pos = simd::find<V>(p, p + n, v);
+			__unwrap<I>::advance(first, static_cast<iter_difference_t<I>>(pos - p));
+			return first;
+		}
+
+		// The number of the n elements starting at first that equal value.
+		template<class I, class T>
+		requires MemSearchable<I, T, identity>
+		iter_difference_t<I>
+		__memcount(const I& first, iter_difference_t<I> n, const T& value) {
+			using V = iter_value_t<__unwrap_t<I>>;
+			const V v = static_cast<V>(value);
+			using C = std::common_type_t<V, __uncvref<T>>;
+			if (n <= 0 || static_cast<C>(v) != static_cast<C>(value)) {
+				return 0;
+			}
+			const auto p = __lowest_address<false>(first, n);
+			return static_cast<iter_difference_t<I>>(simd::count<V>(p, p + n, v));
+		}
+
+		// Comp is greater, possibly behind a reference_wrapper.
+		template<class Comp>
+		inline constexpr bool __compares_greater =
+			Same<__uncvref<__stl2::__unwrap<Comp>>, greater>;
+
+		// Ordering the elements of I by Comp after projecting them through
+		// Proj is ordering their values with < or >.
+		template<class I, class Comp, class Proj>
+		META_CONCEPT MemOrderable =
+			__raw_iterator<I> && !__unwrap<I>::reversed &&
+			__identity_projection<Proj> &&
+			simd::__orderable<iter_value_t<__unwrap_t<I>>> &&
+			(Same<__uncvref<__stl2::__unwrap<Comp>>, less> || __compares_greater<Comp>);
+
+		// Advance first to the min_element - or if Max, the max_element - of
+		// the n > 0 elements starting at first, and return true; or return
+		// false, leaving first alone, if Comp does not order those elements.
+		template<bool Max, class Comp, class I>
+		requires MemOrderable<I, Comp, identity>
+		bool __memextremum(I& first, iter_difference_t<I> n) {
+			const auto p = __lowest_address<false>(first, n);
+			const auto pos = simd::extremum<__compares_greater<Comp> != Max, Max>(
+				p, static_cast<std::size_t>(n));
+			if (pos == simd::unordered) return false;
+			__unwrap<I>::advance(first, static_cast<iter_difference_t<I>>(pos));
+			return true;
+		}
+
+		// Advance min and max, which start at the same position, to the
+		// minmax_element of the n > 0 elements starting there, and return
+		// true; or return false if Comp does not order those elements.
+		template<class Comp, class I>
+		requires MemOrderable<I, Comp, identity>
+		bool __memminmax(I& min, I& max, iter_difference_t<I> n) {
+			const auto p = __lowest_address<false>(min, n);
+			const auto [lo, hi] = simd::minmax<__compares_greater<Comp>>(
+				p, static_cast<std::size_t>(n));
+			if (lo == simd::unordered) return false;
+			__unwrap<I>::advance(min, static_cast<iter_difference_t<I>>(lo));
+			__unwrap<I>::advance(max, static_cast<iter_difference_t<I>>(hi));
+			return true;
+		}
+
+		// Op is std::plus - or if Multiply, std::multiplies - of V or
+		// transparent, possibly behind a reference_wrapper.
+		template<class Op, class V, bool Multiply = false>
+		inline constexpr bool __arithmetic_op = Multiply
+			? Same<__uncvref<__stl2::__unwrap<Op>>, std::multiplies<>> ||
+				Same<__uncvref<__stl2::__unwrap<Op>>, std::multiplies<V>>
+			: Same<__uncvref<__stl2::__unwrap<Op>>, std::plus<>> ||
+				Same<__uncvref<__stl2::__unwrap<Op>>, std::plus<V>>;
+
+		// Reducing the elements of I, projected through Proj, into a T
+		// with Op is adding - or multiplying - their values.
+		template<class I, class T, class Op, class Proj>
+		META_CONCEPT MemReducible =
+			__raw_iterator<I> && __identity_projection<Proj> &&
+			Same<T, iter_value_t<__unwrap_t<I>>> && simd::__arithmetic<T> &&
+			(__arithmetic_op<Op, T> || __arithmetic_op<Op, T, true>);
+
+		// init combined by Op with the n elements starting at first, in
+		// an unspecified order.
+		template<class Op, class I, class T>
+		requires MemReducible<I, T, Op, identity>
+		T __memreduce(const I& first, iter_difference_t<I> n, const T init) {
+			if (n <= 0) return init;
+			constexpr bool multiply = __arithmetic_op<Op, T, true>;
+			const T x = simd::reduce<multiply>(__lowest_address<false>(first, n),
+				static_cast<std::size_t>(n));
+			return simd::__combine<multiply>(init, x);
+		}
+
+		// Reducing with Op1 the results of Op2 on pairs of elements of I1
+		// and I2, projected through Proj1 and Proj2, into a T is summing
+		// the products of their values.
+		template<class I1, class I2, class T, class Op1, class Op2, class Proj1, class Proj2>
+		META_CONCEPT MemDottable =
+			__raw_iterator<I1> && __raw_iterator<I2> &&
+			__unwrap<I1>::reversed == __unwrap<I2>::reversed &&
+			__identity_projection<Proj1> && __identity_projection<Proj2> &&
+			Same<T, iter_value_t<__unwrap_t<I1>>> &&
+			Same<T, iter_value_t<__unwrap_t<I2>>> && simd::__arithmetic<T> &&
+			__arithmetic_op<Op1, T> && __arithmetic_op<Op2, T, true>;
+
+		// init plus the sum of the products of the n pairs of elements
+		// starting at first1 and first2, in an unspecified order.
+		template<class I1, class I2, class T>
+		requires MemDottable<I1, I2, T, std::plus<>, std::multiplies<>, identity, identity>
+		T __memdot(const I1& first1, const I2& first2, iter_difference_t<I1> n, const T init) {
+			if (n <= 0) return init;
+			return init + simd::dot(__lowest_address<false>(first1, n),
+				__lowest_address<false>(first2, static_cast<iter_difference_t<I2>>(n)),
+				static_cast<std::size_t>(n));
+		}
+
+		// The elements of I, projected through Proj, and of O are T
+		// values in arrays walked forward, which the scan kernels can read
+		// and write.
+		template<class I, class O, class T, class Proj>
+		META_CONCEPT __scannable =
+			__raw_iterator<I> && !__unwrap<I>::reversed &&
+			__raw_iterator<O> && !__unwrap<O>::reversed &&
+			__identity_projection<Proj> &&
+			Same<T, iter_value_t<__unwrap_t<I>>> &&
+			Same<T, iter_value_t<__unwrap_t<O>>> &&
+			std::is_trivially_assignable_v<iter_reference_t<O>, const T&> &&
+			simd::__arithmetic<T>;
+
+		// Scanning the elements of I, projected through Proj, into O with
+		// Op, accumulating in a T, is adding their values.
+		template<class I, class O, class T, class Op, class Proj>
+		META_CONCEPT MemScannable =
+			__scannable<I, O, T, Proj> && __arithmetic_op<Op, T>;
+
+		// Store to the n elements starting at result the running sums,
+		// from init, of the n elements starting at first - each inclusive
+		// of its own element or, if Exclusive, of those before it - in an
+		// unspecified order, and advance both past them. Returns init plus
+		// the sum of them all.
+		template<bool Exclusive, class I, class O, class T>
+		requires MemScannable<I, O, T, std::plus<>, identity>
+		T __memscan(I& first, iter_difference_t<I> n, O& result, const T init) {
+			if (n <= 0) return init;
+			const auto m = static_cast<iter_difference_t<O>>(n);
+			const T sum = simd::scan<Exclusive>(__lowest_address<false>(first, n),
+				__lowest_address<false>(result, m), static_cast<std::size_t>(n), init);
+			__unwrap<I>::advance(first, n);
+			__unwrap<O>::advance(result, m);
+			return sum;
+		}
+
+		// Applying Op to pairs of adjacent elements of I, projected
+		// through Proj, and storing the results to O is subtracting their
+		// values.
+		template<class I, class O, class Op, class Proj>
+		META_CONCEPT MemDifferenceable =
+			__scannable<I, O, iter_value_t<__unwrap_t<I>>, Proj> &&
+			(Same<__uncvref<__stl2::__unwrap<Op>>, std::minus<>> ||
+				Same<__uncvref<__stl2::__unwrap<Op>>,
+					std::minus<iter_value_t<__unwrap_t<I>>>>);
+
+		// Store to the n elements starting at result the difference
+		// between each of the n elements starting at first and the one
+		// before it - prev, for the first - and advance both past them.
+		template<class I, class O>
+		requires MemDifferenceable<I, O, std::minus<>, identity>
+		void __memdifference(I& first, iter_difference_t<I> n, O& result,
+			const iter_value_t<__unwrap_t<I>> prev)
+		{
+			if (n <= 0) return;
+			const auto m = static_cast<iter_difference_t<O>>(n);
+			simd::differences(__lowest_address<false>(first, n),
+				__lowest_address<false>(result, m), static_cast<std::size_t>(n), prev);
+			__unwrap<I>::advance(first, n);
+			__unwrap<O>::advance(result, m);
+		}
+
+		// Comparing the elements of I1 and I2 with Pred after projecting
+		// them through Proj1 and Proj2 is comparing their bytes.
+		template<class I1, class I2, class Pred, class Proj1, class Proj2>
+		META_CONCEPT MemComparable =
+			__raw_iterator<I1> && __raw_iterator<I2> &&
+			__unwrap<I1>::reversed == __unwrap<I2>::reversed &&
+			Same<iter_value_t<__unwrap_t<I1>>, iter_value_t<__unwrap_t<I2>>> &&
+			simd::__searchable<iter_value_t<__unwrap_t<I1>>> &&
+			Same<__uncvref<__stl2::__unwrap<Pred>>, equal_to> &&
+			__identity_projection<Proj1> && __identity_projection<Proj2>;
+
+		// Are the n elements starting at first1 equal to the n elements
+		// starting at first2?
+		template<class I1, class I2>
+		requires MemComparable<I1, I2, equal_to, identity, identity>
+		bool __memequal(const I1& first1, const I2& first2, iter_difference_t<I1> n) {
+			if (n <= 0) return true;
+			// Equality doesn't care which way the elements are visited.
+			return std::memcmp(
+				__lowest_address<false>(first1, n),
+				__lowest_address<false>(first2, static_cast<iter_difference_t<I2>>(n)),
+				static_cast<std::size_t>(n) * sizeof(iter_value_t<__unwrap_t<I1>>)) == 0;
+		}
+
+		// Advance first1 and first2 to the first position - within the next
+		// n - at which they denote different values.
+		template<class I1, class I2>
+		requires MemComparable<I1, I2, equal_to, identity, identity> &&
+			!__unwrap<I1>::reversed
+		void __mismatch_forward(I1& first1, I2& first2, iter_difference_t<I1> n) {
+			if (n <= 0) return;
+			using V = iter_value_t<__unwrap_t<I1>>;
+			const auto i = simd::mismatch<V>(
+				__lowest_address<false>(first1, n),
+				__lowest_address<false>(first2, static_cast<iter_difference_t<I2>>(n)),
+				static_cast<std::size_t>(n));
+			__unwrap<I1>::advance(first1, static_cast<iter_difference_t<I1>>(i));
+			__unwrap<I2>::advance(first2, static_cast<iter_difference_t<I2>>(i));
+		}
+
+		// The contiguous bytes of type V at which __memsearch can look for
+		// a pattern.
+		template<class I, class V>
+		META_CONCEPT __byte_haystack =
+			__raw_iterator<I> && !__unwrap<I>::reversed &&
+			Same<iter_value_t<__unwrap_t<I>>, V> &&
+			simd::__searchable<V> && sizeof(V) == 1;
+
+		// Advance first to the first occurrence of the m-element needle in
+		// the n elements starting at first - or past those n elements if
+		// there is none - and return whether it was found.
+		template<class I, class V>
+		requires __byte_haystack<I, V>
+		bool __memsearch(I& first, iter_difference_t<I> n,
+			const V* needle, std::size_t m)
+		{
+			if (m == 0) return true;
+			if (n <= 0) return false;
+			const auto p = __lowest_address<false>(first, n);
+			const auto pos = simd::search<V>(p, static_cast<std::size_t>(n), needle, m);
+			const bool found = pos != static_cast<std::size_t>(n);
+			__unwrap<I>::advance(first, found ? static_cast<iter_difference_t<I>>(pos) : n);
+			return found;
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -12,7 +12,11 @@
 #ifndef STL2_DETAIL_ALGORITHM_COPY_HPP
 #define STL2_DETAIL_ALGORITHM_COPY_HPP
 
+#include <stl2/detail/algorithm/contiguous.hpp>
 #include <stl2/detail/algorithm/results.hpp>
+#include <stl2/detail/execution.hpp>
+#include <stl2/detail/iostream/streambuf.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
 #include <stl2/detail/range/concepts.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
@@ -28,6 +32,36 @@ STL2_OPEN_NAMESPACE {
 		requires IndirectlyCopyable<I, O>
 		constexpr copy_result<I, O>
 		operator()(I first, S last, O result) const {
+			if constexpr (SizedSentinel<S, I> && detail::MemCopyable<I, O>) {
+				if (!detail::is_constant_evaluated()) {
+					detail::__memmove_forward(first, last - first, result);
+					return {std::move(first), std::move(result)};
+				}
+			} else if constexpr (SizedSentinel<S, I> && detail::StridedCopyable<I, O>) {
+				if (!detail::is_constant_evaluated()) {
+					detail::__gather_forward(first, last - first, result);
+					return {std::move(first), std::move(result)};
+				}
+			} else if constexpr (SizedSentinel<S, I> && detail::__sputn_copyable<I, O>) {
+				detail::__sputn_forward(first, last - first, result);
+				return {std::move(first), std::move(result)};
+			} else if constexpr (ext::SegmentedIterator<I> && Same<S, I>) {
+				ext::for_each_segment(first, last, [&](const auto& seg) {
+					result = (*this)(seg.begin(), seg.end(), std::move(result)).out;
+					return true;
+				});
+				return {std::move(last), std::move(result)};
+			} else if constexpr (detail::__istreambuf_range<I, S> &&
+				IndirectlyCopyable<const iter_value_t<I>*, O>)
+			{
+				if (detail::__end_of_stream(last)) {
+					detail::__for_each_get_segment(first.rdbuf(), [&](auto p, auto l) {
+						result = (*this)(p, l, std::move(result)).out;
+						return l;
+					});
+					return {I{}, std::move(result)};
+				}
+			}
 			for (; first != last; (void) ++first, (void) ++result) {
 				*result = *first;
 			}
@@ -40,6 +74,34 @@ STL2_OPEN_NAMESPACE {
 		operator()(R&& r, O result) const {
 			return (*this)(begin(r), end(r), std::move(result));
 		}
+
+		// Extension: execution policies
+		template<ext::ExecutionPolicy EP, RandomAccessIterator I, SizedSentinel<I> S,
+			RandomAccessIterator O>
+		requires IndirectlyCopyable<I, O>
+		copy_result<I, O>
+		operator()(EP&& policy, I first, S last, O result) const {
+			using D = iter_difference_t<I>;
+			const auto n = D(last - first);
+			if constexpr (detail::__parallel_policy<EP>) {
+				detail::parallel_for(policy.pool(), n, D(detail::__parallel_grain),
+					[&](D b, D e) {
+						(*this)(first + b, first + e, result + iter_difference_t<O>(b));
+					});
+				return {first + n, result + iter_difference_t<O>(n)};
+			} else {
+				auto stop = first + n;
+				return (*this)(std::move(first), std::move(stop), std::move(result));
+			}
+		}
+
+		template<ext::ExecutionPolicy EP, detail::__parallel_range R,
+			RandomAccessIterator O>
+		requires IndirectlyCopyable<iterator_t<R>, O>
+		copy_result<safe_iterator_t<R>, O>
+		operator()(EP&& policy, R&& r, O result) const {
+			return (*this)(std::forward<EP>(policy), begin(r), end(r), std::move(result));
+		}
 	};
 
 	inline constexpr __copy_fn copy {};
@@ -50,10 +112,7 @@ STL2_OPEN_NAMESPACE {
 			requires IndirectlyCopyable<I, O>
 			constexpr copy_result<I, O>
 			operator()(I first, S last, O result) const {
-				for (; first != last; (void) ++first, (void) ++result) {
-					*result = *first;
-				}
-				return {std::move(first), std::move(result)};
+				return __stl2::copy(std::move(first), std::move(last), std::move(result));
 			}
 
 			template<InputRange R, class O>
@@ -70,6 +129,17 @@ STL2_OPEN_NAMESPACE {
 			requires IndirectlyCopyable<I1, I2>
 			constexpr copy_result<I1, I2>
 			operator()(I1 first, S1 last, I2 rfirst, S2 rlast) const {
+				if constexpr (SizedSentinel<S1, I1> && SizedSentinel<S2, I2> &&
+					detail::MemCopyable<I1, I2>)
+				{
+					if (!detail::is_constant_evaluated()) {
+						auto n = last - first;
+						auto rn = rlast - rfirst;
+						if (rn < n) n = static_cast<iter_difference_t<I1>>(rn);
+						detail::__memmove_forward(first, n, rfirst);
+						return {std::move(first), std::move(rfirst)};
+					}
+				}
 				for (; first != last && rfirst != rlast; (void) ++first, (void)++rfirst) {
 					*rfirst = *first;
 				}
@@ -13,6 +13,7 @@
 #ifndef STL2_DETAIL_ALGORITHM_COPY_BACKWARD_HPP
 #define STL2_DETAIL_ALGORITHM_COPY_BACKWARD_HPP
 
+#include <stl2/detail/algorithm/contiguous.hpp>
 #include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/range/concepts.hpp>
 #include <stl2/detail/range/dangling.hpp>
@@ -29,6 +30,14 @@ STL2_OPEN_NAMESPACE {
 		requires IndirectlyCopyable<I1, I2>
 		constexpr copy_backward_result<I1, I2>
 		operator()(I1 first, S1 sent, I2 out) const {
+			if constexpr (SizedSentinel<S1, I1> && detail::MemCopyable<I1, I2>) {
+				if (!detail::is_constant_evaluated()) {
+					auto n = sent - first;
+					detail::__unwrap<I1>::advance(first, n);
+					detail::__memmove_backward(first, n, out);
+					return {std::move(first), std::move(out)};
+				}
+			}
 			auto last = next(first, std::move(sent));
 			auto i = last;
 			while (i != first) {
@@ -12,7 +12,9 @@
 #ifndef STL2_DETAIL_ALGORITHM_COUNT_HPP
 #define STL2_DETAIL_ALGORITHM_COUNT_HPP
 
+#include <stl2/detail/algorithm/contiguous.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
 #include <stl2/detail/range/concepts.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -24,7 +26,20 @@ STL2_OPEN_NAMESPACE {
 		requires IndirectRelation<equal_to, projected<I, Proj>, const T*>
 		constexpr iter_difference_t<I>
 		operator()(I first, S last, const T& value, Proj proj = {}) const {
+			if constexpr (SizedSentinel<S, I> && detail::MemSearchable<I, T, Proj>) {
+				if (!detail::is_constant_evaluated()) {
+					return detail::__memcount(first, last - first, value);
+				}
+			}
 			iter_difference_t<I> n = 0;
+			if constexpr (ext::SegmentedIterator<I> && Same<S, I>) {
+				ext::for_each_segment(first, last, [&](const auto& seg) {
+					n += static_cast<iter_difference_t<I>>(
+						(*this)(seg.begin(), seg.end(), value, __stl2::ref(proj)));
+					return true;
+				});
+				return n;
+			}
 			for (; first != last; ++first) {
 				if (__stl2::invoke(proj, *first) == value) {
 					++n;
@@ -13,6 +13,7 @@
 #define STL2_DETAIL_ALGORITHM_COUNT_IF_HPP
 
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution.hpp>
 #include <stl2/detail/range/concepts.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -39,6 +40,36 @@ STL2_OPEN_NAMESPACE {
 		operator()(R&& r, Pred pred, Proj proj = {}) const {
 			return (*this)(begin(r), end(r), __stl2::ref(pred), __stl2::ref(proj));
 		}
+
+		// Extension: execution policies
+		template<ext::ExecutionPolicy EP, RandomAccessIterator I, SizedSentinel<I> S,
+			class Proj = identity, IndirectUnaryPredicate<projected<I, Proj>> Pred>
+		iter_difference_t<I>
+		operator()(EP&& policy, I first, S last, Pred pred, Proj proj = {}) const {
+			using D = iter_difference_t<I>;
+			const auto n = D(last - first);
+			if constexpr (detail::__parallel_policy<EP>) {
+				std::atomic<D> count{0};
+				detail::parallel_for(policy.pool(), n, D(detail::__parallel_grain),
+					[&](D b, D e) {
+						count.fetch_add((*this)(first + b, first + e,
+							__stl2::ref(pred), __stl2::ref(proj)), std::memory_order_relaxed);
+					});
+				return count.load(std::memory_order_relaxed);
+			} else {
+				auto stop = first + n;
+				return (*this)(std::move(first), std::move(stop), __stl2::ref(pred),
+					__stl2::ref(proj));
+			}
+		}
+
+		template<ext::ExecutionPolicy EP, detail::__parallel_range R, class Proj = identity,
+			IndirectUnaryPredicate<projected<iterator_t<R>, Proj>> Pred>
+		iter_difference_t<iterator_t<R>>
+		operator()(EP&& policy, R&& r, Pred pred, Proj proj = {}) const {
+			return (*this)(std::forward<EP>(policy), begin(r), end(r),
+				__stl2::ref(pred), __stl2::ref(proj));
+		}
 	};
 
 	inline constexpr __count_if_fn count_if {};
@@ -28,6 +28,15 @@ STL2_OPEN_NAMESPACE {
 			constexpr subrange<I>
 			operator()(I first, iter_difference_t<I> dist, const T& value,
 				Comp comp = {}, Proj proj = {}) const {
+				if constexpr (detail::__branchless_bisectable<I, Proj>) {
+					// Two branchless searches beat one branchy search that
+					// stops early.
+					auto lower = ext::lower_bound_n(first, dist, value,
+						__stl2::ref(comp), __stl2::ref(proj));
+					auto upper = ext::upper_bound_n(lower, dist - (lower - first), value,
+						__stl2::ref(comp), __stl2::ref(proj));
+					return {std::move(lower), std::move(upper)};
+				}
 				if (0 < dist) {
 					do {
 						auto half = dist / 2;
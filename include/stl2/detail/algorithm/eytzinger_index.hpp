@@ -0,0 +1,185 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_EYTZINGER_INDEX_HPP
+#define STL2_DETAIL_ALGORITHM_EYTZINGER_INDEX_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/partition_point.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// eytzinger_index [Extension]
+//
+// A copy of a sorted range laid out in Eytzinger order - the breadth-first
+// order of the implicit complete binary search tree over the elements -
+// for ranges that are searched many times. A search walks down the tree,
+// and the top levels it visits on every search stay in cache; the
+// descendants of a node a few levels down share a cache line, which the
+// search prefetches before it gets there. The steps do not branch on the
+// comparisons.
+//
+// lower_bound, upper_bound and contains have the semantics of the
+// algorithms of the same names applied to the range the index was built
+// from, with positions reported as offsets into that range.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<class T, class Comp = less, class Proj = identity>
+		requires IndirectStrictWeakOrder<Comp, projected<const T*, Proj>>
+		class eytzinger_index {
+		public:
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+
+			eytzinger_index() = default;
+
+			// Precondition: r is sorted with respect to comp and proj.
+			template<RandomAccessRange R>
+			requires SizedRange<R> && Constructible<T, iter_reference_t<iterator_t<R>>>
+			explicit eytzinger_index(R&& r, Comp comp = {}, Proj proj = {})
+			: comp_(std::move(comp)), proj_(std::move(proj))
+			{
+				const auto n = static_cast<std::size_t>(__stl2::distance(r));
+				if (n > 0) {
+					height_ = depth(n) + 1;
+					full_ = (std::size_t{1} << (height_ - 1)) - 1;
+				}
+				using D = iter_difference_t<iterator_t<R>>;
+				auto first = __stl2::begin(r);
+				tree_.reserve(n);
+				for (std::size_t k = 1; k <= n; ++k) {
+					tree_.emplace_back(first[static_cast<D>(rank(k, n))]);
+				}
+			}
+
+			difference_type size() const noexcept {
+				return static_cast<difference_type>(tree_.size());
+			}
+			bool empty() const noexcept {
+				return tree_.empty();
+			}
+
+			// Offset of the first element e of the original range for which
+			// comp(proj(e), value) is false, or size() if there is none.
+			template<class V>
+			requires IndirectStrictWeakOrder<const Comp&, const V*, projected<const T*, Proj>>
+			difference_type lower_bound(const V& value) const {
+				return rank(descend([&](const T& e) {
+					return __stl2::invoke(comp_, __stl2::invoke(proj_, e), value);
+				}), tree_.size());
+			}
+
+			// Offset of the first element e of the original range for which
+			// comp(value, proj(e)) is true, or size() if there is none.
+			template<class V>
+			requires IndirectStrictWeakOrder<const Comp&, const V*, projected<const T*, Proj>>
+			difference_type upper_bound(const V& value) const {
+				return rank(descend([&](const T& e) {
+					return !__stl2::invoke(comp_, value, __stl2::invoke(proj_, e));
+				}), tree_.size());
+			}
+
+			// Is some element of the original range equivalent to value?
+			template<class V>
+			requires IndirectStrictWeakOrder<const Comp&, const V*, projected<const T*, Proj>>
+			bool contains(const V& value) const {
+				const auto k = descend([&](const T& e) {
+					return __stl2::invoke(comp_, __stl2::invoke(proj_, e), value);
+				});
+				return k != 0 &&
+					!__stl2::invoke(comp_, value, __stl2::invoke(proj_, tree_[k - 1]));
+			}
+
+		private:
+			// Nodes per cache line, a power of two: the line_ descendants
+			// of node k that are log2(line_) levels down are adjacent,
+			// starting with node k * line_.
+			static constexpr std::size_t line_ = [] {
+				std::size_t n = 1;
+				while (2 * n * sizeof(T) <= 64) n *= 2;
+				return n;
+			}();
+
+			std::vector<T> tree_;   // tree_[k - 1] is node k
+			int height_ = 0;        // levels in the tree
+			std::size_t full_ = 0;  // nodes above the last level
+			Comp comp_;
+			Proj proj_;
+
+			// Depth of node k; the root has depth 0.
+			static int depth(std::size_t k) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+				return 63 - __builtin_clzll(static_cast<unsigned long long>(k));
+#else
+				int d = 0;
+				for (; k != 1; k /= 2) ++d;
+				return d;
+#endif
+			}
+
+			// Offset in the original range of node k of the n nodes, or n if
+			// k is 0. Computed, rather than looked up, to spare the search
+			// a cache miss: node k's position among the nodes of the perfect
+			// tree of height_ levels, less the absent last-level nodes -
+			// which occupy the even positions - before it.
+			difference_type rank(const std::size_t k, const std::size_t n) const noexcept {
+				if (k == 0) return static_cast<difference_type>(n);
+				const int d = depth(k);
+				const std::size_t p =
+					((2 * (k - (std::size_t{1} << d)) + 1) << (height_ - 1 - d)) - 1;
+				const std::size_t leaves = n - full_;
+				const std::size_t before = (p + 1) / 2;
+				return static_cast<difference_type>(before > leaves ? p - (before - leaves) : p);
+			}
+
+			// The node of the first element in order that does not
+			// satisfy pred, or 0 if every element satisfies it.
+			template<class Pred>
+			std::size_t descend(Pred pred) const {
+				const std::size_t n = tree_.size();
+				std::size_t k = 1;
+				while (k <= n) {
+					if (line_ > 1 && k * line_ <= n) {
+						detail::__prefetch(tree_.data() + (k * line_ - 1));
+					}
+					k = 2 * k + static_cast<std::size_t>(pred(tree_[k - 1]));
+				}
+				// The path went right - past elements that satisfy pred - at
+				// the trailing one bits of k, and left at the node above them.
+#if defined(__GNUC__) || defined(__clang__)
+				return k >> (__builtin_ctzll(~static_cast<unsigned long long>(k)) + 1);
+#else
+				while (k & 1) k >>= 1;
+				return k >> 1;
+#endif
+			}
+		};
+
+		template<Range R>
+		eytzinger_index(R&&) -> eytzinger_index<iter_value_t<iterator_t<R>>>;
+		template<Range R, class Comp>
+		eytzinger_index(R&&, Comp) ->
+			eytzinger_index<iter_value_t<iterator_t<R>>, Comp>;
+		template<Range R, class Comp, class Proj>
+		eytzinger_index(R&&, Comp, Proj) ->
+			eytzinger_index<iter_value_t<iterator_t<R>>, Comp, Proj>;
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
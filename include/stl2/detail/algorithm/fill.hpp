@@ -12,6 +12,9 @@
 #ifndef STL2_DETAIL_ALGORITHM_FILL_HPP
 #define STL2_DETAIL_ALGORITHM_FILL_HPP
 
+#include <stl2/detail/algorithm/contiguous.hpp>
+#include <stl2/detail/execution.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
 #include <stl2/detail/range/concepts.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
@@ -21,6 +24,18 @@ STL2_OPEN_NAMESPACE {
 	struct __fill_fn : private __niebloid {
 		template<class T, OutputIterator<const T&> O, Sentinel<O> S>
 		constexpr O operator()(O first, S last, const T& value) const {
+			if constexpr (SizedSentinel<S, O> && detail::MemFillable<O, T>) {
+				if (!detail::is_constant_evaluated()) {
+					detail::__memset_forward(first, last - first, value);
+					return first;
+				}
+			} else if constexpr (ext::SegmentedIterator<O> && Same<S, O>) {
+				ext::for_each_segment(first, last, [&](const auto& seg) {
+					(*this)(seg.begin(), seg.end(), value);
+					return true;
+				});
+				return last;
+			}
 			for (; first != last; ++first) {
 				*first = value;
 			}
@@ -31,6 +46,29 @@ STL2_OPEN_NAMESPACE {
 		constexpr safe_iterator_t<R> operator()(R&& r, const T& value) const {
 			return (*this)(begin(r), end(r), value);
 		}
+
+		// Extension: execution policies
+		template<ext::ExecutionPolicy EP, class T, RandomAccessIterator O,
+			SizedSentinel<O> S>
+		requires OutputIterator<O, const T&>
+		O operator()(EP&& policy, O first, S last, const T& value) const {
+			using D = iter_difference_t<O>;
+			const auto n = D(last - first);
+			if constexpr (detail::__parallel_policy<EP>) {
+				detail::parallel_for(policy.pool(), n, D(detail::__parallel_grain),
+					[&](D b, D e) { (*this)(first + b, first + e, value); });
+				return first + n;
+			} else {
+				auto stop = first + n;
+				return (*this)(std::move(first), std::move(stop), value);
+			}
+		}
+
+		template<ext::ExecutionPolicy EP, class T, detail::__parallel_range R>
+		requires OutputRange<R, const T&>
+		safe_iterator_t<R> operator()(EP&& policy, R&& r, const T& value) const {
+			return (*this)(std::forward<EP>(policy), begin(r), end(r), value);
+		}
 	};
 
 	inline constexpr __fill_fn fill {};
@@ -12,6 +12,7 @@
 #ifndef STL2_DETAIL_ALGORITHM_FILL_N_HPP
 #define STL2_DETAIL_ALGORITHM_FILL_N_HPP
 
+#include <stl2/detail/algorithm/contiguous.hpp>
 #include <stl2/detail/iterator/concepts.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -22,6 +23,12 @@ STL2_OPEN_NAMESPACE {
 		template<class T, OutputIterator<const T&> O>
 		constexpr O
 		operator()(O first, iter_difference_t<O> n, const T& value) const {
+			if constexpr (detail::MemFillable<O, T>) {
+				if (!detail::is_constant_evaluated()) {
+					detail::__memset_forward(first, n, value);
+					return first;
+				}
+			}
 			for (; n > 0; --n, (void)++first) {
 				*first = value;
 			}
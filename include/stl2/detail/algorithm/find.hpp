@@ -12,7 +12,10 @@
 #ifndef STL2_DETAIL_ALGORITHM_FIND_HPP
 #define STL2_DETAIL_ALGORITHM_FIND_HPP
 
+#include <stl2/detail/algorithm/contiguous.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iostream/streambuf.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -24,6 +27,31 @@ STL2_OPEN_NAMESPACE {
 		requires IndirectRelation<equal_to, projected<I, Proj>, const T*>
 		constexpr I
 		operator()(I first, S last, const T& value, Proj proj = {}) const {
+			if constexpr (SizedSentinel<S, I> && detail::MemSearchable<I, T, Proj>) {
+				if (!detail::is_constant_evaluated()) {
+					return detail::__memchr_forward(std::move(first), last - first, value);
+				}
+			} else if constexpr (ext::SegmentedIterator<I> && Same<S, I>) {
+				I pos = last;
+				ext::for_each_segment(first, last, [&](const auto& seg) {
+					auto i = (*this)(seg.begin(), seg.end(), value, __stl2::ref(proj));
+					if (i == seg.end()) return true;
+					pos = seg.compose(std::move(i));
+					return false;
+				});
+				return pos;
+			} else if constexpr (detail::__istreambuf_range<I, S> &&
+				IndirectRelation<equal_to, projected<const iter_value_t<I>*, Proj>, const T*>)
+			{
+				if (detail::__end_of_stream(last)) {
+					const auto sbuf = first.rdbuf();
+					const bool found = detail::__for_each_get_segment(sbuf,
+						[&](auto p, auto l) {
+							return (*this)(p, l, value, __stl2::ref(proj));
+						});
+					return found ? I{sbuf} : I{};
+				}
+			}
 			for (; first != last; ++first) {
 				if (__stl2::invoke(proj, *first) == value) {
 					break;
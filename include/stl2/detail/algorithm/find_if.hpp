@@ -13,6 +13,8 @@
 #define STL2_DETAIL_ALGORITHM_FIND_IF_HPP
 
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -24,6 +26,17 @@ STL2_OPEN_NAMESPACE {
 			IndirectUnaryPredicate<projected<I, Proj>> Pred>
 		constexpr I
 		operator()(I first, S last, Pred pred, Proj proj = {}) const {
+			if constexpr (ext::SegmentedIterator<I> && Same<S, I>) {
+				I pos = last;
+				ext::for_each_segment(first, last, [&](const auto& seg) {
+					auto i = (*this)(seg.begin(), seg.end(), __stl2::ref(pred),
+						__stl2::ref(proj));
+					if (i == seg.end()) return true;
+					pos = seg.compose(std::move(i));
+					return false;
+				});
+				return pos;
+			}
 			for (; first != last; ++first) {
 				if (__stl2::invoke(pred, __stl2::invoke(proj, *first))) {
 					break;
@@ -39,6 +52,34 @@ STL2_OPEN_NAMESPACE {
 			return (*this)(begin(r), end(r), __stl2::ref(pred),
 				__stl2::ref(proj));
 		}
+
+		// Extension: execution policies. Threads stop searching once an
+		// earlier match has been found.
+		template<ext::ExecutionPolicy EP, RandomAccessIterator I, SizedSentinel<I> S,
+			class Proj = identity, IndirectUnaryPredicate<projected<I, Proj>> Pred>
+		I operator()(EP&& policy, I first, S last, Pred pred, Proj proj = {}) const {
+			using D = iter_difference_t<I>;
+			const auto n = D(last - first);
+			if constexpr (detail::__parallel_policy<EP>) {
+				return first + detail::parallel_find(policy.pool(), n,
+					D(detail::__parallel_grain), [&](D b, D e) {
+						return D((*this)(first + b, first + e, __stl2::ref(pred),
+							__stl2::ref(proj)) - first);
+					});
+			} else {
+				auto stop = first + n;
+				return (*this)(std::move(first), std::move(stop), __stl2::ref(pred),
+					__stl2::ref(proj));
+			}
+		}
+
+		template<ext::ExecutionPolicy EP, detail::__parallel_range R, class Proj = identity,
+			IndirectUnaryPredicate<projected<iterator_t<R>, Proj>> Pred>
+		safe_iterator_t<R>
+		operator()(EP&& policy, R&& r, Pred pred, Proj proj = {}) const {
+			return (*this)(std::forward<EP>(policy), begin(r), end(r),
+				__stl2::ref(pred), __stl2::ref(proj));
+		}
 	};
 
 	inline constexpr __find_if_fn find_if {};
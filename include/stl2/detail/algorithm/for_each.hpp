@@ -14,6 +14,8 @@
 
 #include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -28,6 +30,13 @@ STL2_OPEN_NAMESPACE {
 			IndirectUnaryInvocable<projected<I, Proj>> F>
 		constexpr for_each_result<I, F>
 		operator()(I first, S last, F fun, Proj proj = {}) const {
+			if constexpr (ext::SegmentedIterator<I> && Same<S, I>) {
+				ext::for_each_segment(first, last, [&](const auto& seg) {
+					(*this)(seg.begin(), seg.end(), __stl2::ref(fun), __stl2::ref(proj));
+					return true;
+				});
+				return {std::move(last), std::move(fun)};
+			}
 			for (; first != last; ++first) {
 				__stl2::invoke(fun, __stl2::invoke(proj, *first));
 			}
@@ -40,6 +49,32 @@ STL2_OPEN_NAMESPACE {
 		operator()(R&& r, F fun, Proj proj = {}) const {
 			return (*this)(begin(r), end(r), std::move(fun), std::move(proj));
 		}
+
+		// Extension: execution policies. Calls fun concurrently, and
+		// returns only the end of the input.
+		template<ext::ExecutionPolicy EP, RandomAccessIterator I, SizedSentinel<I> S,
+			class Proj = identity, IndirectUnaryInvocable<projected<I, Proj>> F>
+		I operator()(EP&& policy, I first, S last, F fun, Proj proj = {}) const {
+			const auto n = iter_difference_t<I>(last - first);
+			if constexpr (detail::__parallel_policy<EP>) {
+				detail::parallel_for(policy.pool(), n,
+					iter_difference_t<I>(detail::__parallel_grain),
+					[&](auto b, auto e) {
+						(*this)(first + b, first + e, __stl2::ref(fun), __stl2::ref(proj));
+					});
+			} else {
+				(*this)(first, first + n, __stl2::ref(fun), __stl2::ref(proj));
+			}
+			return first + n;
+		}
+
+		template<ext::ExecutionPolicy EP, detail::__parallel_range R,
+			class Proj = identity,
+			IndirectUnaryInvocable<projected<iterator_t<R>, Proj>> F>
+		safe_iterator_t<R> operator()(EP&& policy, R&& r, F fun, Proj proj = {}) const {
+			return (*this)(std::forward<EP>(policy), begin(r), end(r),
+				__stl2::ref(fun), __stl2::ref(proj));
+		}
 	};
 
 	inline constexpr __for_each_fn for_each {};
@@ -142,24 +142,44 @@ STL2_OPEN_NAMESPACE {
 				temporary_vector<iter_value_t<I>> vec{buf};
 				if (len1 <= len2) {
 					move(first, middle, __stl2::back_inserter(vec));
-					merge(
-						__stl2::make_move_iterator(begin(vec)),
-						__stl2::make_move_iterator(end(vec)),
-						__stl2::make_move_iterator(std::move(middle)),
-						__stl2::make_move_iterator(std::move(last)),
-						std::move(first), __stl2::ref(pred),
-						__stl2::ref(proj), __stl2::ref(proj));
+					half_merge(begin(vec), end(vec), std::move(middle),
+						std::move(last), std::move(first), pred, proj);
 				} else {
 					move(middle, last, __stl2::back_inserter(vec));
 					using RBi = reverse_iterator<I>;
-					merge(
-						__stl2::make_move_iterator(RBi{std::move(middle)}),
-						__stl2::make_move_iterator(RBi{std::move(first)}),
-						__stl2::make_move_iterator(rbegin(vec)),
-						__stl2::make_move_iterator(rend(vec)),
-						RBi{std::move(last)},
-						__stl2::not_fn(__stl2::ref(pred)),
-						__stl2::ref(proj), __stl2::ref(proj));
+					// Backwards, the buffered elements come first among
+					// equivalents.
+					auto flipped = [&pred](auto&& x, auto&& y) {
+						return __stl2::invoke(pred, std::forward<decltype(y)>(y),
+							std::forward<decltype(x)>(x));
+					};
+					half_merge(rbegin(vec), rend(vec), RBi{std::move(middle)},
+						RBi{std::move(first)}, RBi{std::move(last)}, flipped, proj);
+				}
+			}
+
+			// Merge the buffered [first1, last1) with [first2, last2), which
+			// ends where the output does: once the buffer is empty, the
+			// rest of [first2, last2) is already in place. (Moving it onto
+			// itself would leave the elements in a moved-from state.)
+			template<class B, class I, class C, class P>
+			static void half_merge(B first1, B last1, I first2, I last2, I result,
+				C& pred, P& proj)
+			{
+				for (; first1 != last1; ++result) {
+					if (first2 == last2) {
+						move(first1, last1, std::move(result));
+						return;
+					}
+					if (__stl2::invoke(pred, __stl2::invoke(proj, *first2),
+						__stl2::invoke(proj, *first1)))
+					{
+						*result = iter_move(first2);
+						++first2;
+					} else {
+						*result = iter_move(first1);
+						++first1;
+					}
 				}
 			}
 		};
@@ -13,7 +13,9 @@
 #define STL2_DETAIL_ALGORITHM_LOWER_BOUND_HPP
 
 #include <stl2/detail/algorithm/partition_point.hpp>
+#include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/range/dangling.hpp>
 #include <stl2/detail/range/primitives.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -75,6 +77,82 @@ STL2_OPEN_NAMESPACE {
 	};
 
 	inline constexpr __lower_bound_fn lower_bound {};
+
+	namespace ext {
+		template<class I, class O>
+		using lower_bound_many_result = __in_out_result<I, O>;
+
+		// Write the lower bound in [first, last) of each of the needles
+		// through out, in order. The searches run in lockstep, a group at a
+		// time: each step of one search prefetches its next probe, and
+		// the steps of the others hide the latency of that load.
+		struct __lower_bound_many_fn : private __niebloid {
+			template<RandomAccessIterator I, SizedSentinel<I> S,
+				ForwardIterator I2, Sentinel<I2> S2, WeaklyIncrementable O,
+				class Comp = less, class Proj = identity>
+			requires Writable<O, const I&> &&
+				IndirectStrictWeakOrder<Comp, I2, projected<I, Proj>>
+			constexpr lower_bound_many_result<I2, O>
+			operator()(I first, S last, I2 nfirst, S2 nlast, O out,
+				Comp comp = {}, Proj proj = {}) const
+			{
+				using D = iter_difference_t<I>;
+				constexpr int group = 16;
+				const D size = last - first;
+				I2 needles[group] {};
+				I bases[group] {};
+				while (nfirst != nlast) {
+					int m = 0;
+					for (; m < group && nfirst != nlast; ++m, (void) ++nfirst) {
+						needles[m] = nfirst;
+						bases[m] = first;
+					}
+					if (size > 0) {
+						D n = size;
+						while (n > 1) {
+							const D half = n / 2;
+							n -= half;
+							for (int k = 0; k < m; ++k) {
+								const bool right = __stl2::invoke(comp,
+									__stl2::invoke(proj, bases[k][half]), *needles[k]);
+								bases[k] += right ? half : D{0};
+								if (!detail::is_constant_evaluated()) {
+									detail::__prefetch(bases[k] + n / 2);
+								}
+							}
+						}
+						for (int k = 0; k < m; ++k) {
+							bases[k] += __stl2::invoke(comp,
+								__stl2::invoke(proj, *bases[k]), *needles[k]) ? D{1} : D{0};
+						}
+					}
+					for (int k = 0; k < m; ++k, (void) ++out) {
+						*out = bases[k];
+					}
+				}
+				return {std::move(nfirst), std::move(out)};
+			}
+
+			template<RandomAccessRange R, ForwardRange R2, WeaklyIncrementable O,
+				class Comp = less, class Proj = identity>
+			requires SizedRange<R> &&
+				(std::is_lvalue_reference_v<R> || _ForwardingRange<R>) &&
+				Writable<O, const iterator_t<R>&> &&
+				IndirectStrictWeakOrder<Comp, iterator_t<R2>,
+					projected<iterator_t<R>, Proj>>
+			constexpr lower_bound_many_result<safe_iterator_t<R2>, O>
+			operator()(R&& haystack, R2&& needles, O out, Comp comp = {},
+				Proj proj = {}) const
+			{
+				auto first = begin(haystack);
+				return (*this)(first, first + distance(haystack),
+					begin(needles), end(needles), std::move(out),
+					__stl2::ref(comp), __stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __lower_bound_many_fn lower_bound_many {};
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
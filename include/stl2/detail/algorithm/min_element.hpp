@@ -12,6 +12,7 @@
 #ifndef STL2_DETAIL_ALGORITHM_MIN_ELEMENT_HPP
 #define STL2_DETAIL_ALGORITHM_MIN_ELEMENT_HPP
 
+#include <stl2/detail/algorithm/contiguous.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
@@ -24,6 +25,14 @@ STL2_OPEN_NAMESPACE {
 			IndirectStrictWeakOrder<projected<I, Proj>> Comp = less>
 		constexpr I
 		operator()(I first, S last, Comp comp = {}, Proj proj = {}) const {
+			if constexpr (SizedSentinel<S, I> && detail::MemOrderable<I, Comp, Proj>) {
+				if (!detail::is_constant_evaluated()) {
+					if (const auto n = last - first;
+						n > 0 && detail::__memextremum<false, Comp>(first, n)) {
+						return first;
+					}
+				}
+			}
 			if (first != last) {
 				for (auto i = next(first); i != last; ++i) {
 					if (__stl2::invoke(comp,
@@ -16,6 +16,7 @@
 #ifndef STL2_DETAIL_ALGORITHM_MINMAX_ELEMENT_HPP
 #define STL2_DETAIL_ALGORITHM_MINMAX_ELEMENT_HPP
 
+#include <stl2/detail/algorithm/contiguous.hpp>
 #include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 #include <stl2/detail/range/dangling.hpp>
@@ -31,6 +32,14 @@ STL2_OPEN_NAMESPACE {
 		operator()(I first, S last, Comp comp = {}, Proj proj = {}) const
 		{
 			minmax_result<I> result{first, first};
+			if constexpr (SizedSentinel<S, I> && detail::MemOrderable<I, Comp, Proj>) {
+				if (!detail::is_constant_evaluated()) {
+					if (const auto n = last - first;
+						n > 0 && detail::__memminmax<Comp>(result.min, result.max, n)) {
+						return result;
+					}
+				}
+			}
 			if (first == last || ++first == last) return result;
 
 			auto pred = [&](auto&& lhs, auto&& rhs) -> bool {
@@ -12,6 +12,7 @@
 #ifndef STL2_DETAIL_ALGORITHM_MISMATCH_HPP
 #define STL2_DETAIL_ALGORITHM_MISMATCH_HPP
 
+#include <stl2/detail/algorithm/contiguous.hpp>
 #include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 #include <stl2/detail/range/primitives.hpp>
@@ -32,6 +33,18 @@ STL2_OPEN_NAMESPACE {
 		operator()(I1 first1, S1 last1, I2 first2, S2 last2, Pred pred = {},
 			Proj1 proj1 = {}, Proj2 proj2 = {}) const
 		{
+			if constexpr (SizedSentinel<S1, I1> && SizedSentinel<S2, I2> &&
+				detail::MemComparable<I1, I2, Pred, Proj1, Proj2> &&
+				!detail::__unwrap<I1>::reversed)
+			{
+				if (!detail::is_constant_evaluated()) {
+					auto n = last1 - first1;
+					auto n2 = last2 - first2;
+					if (n2 < n) n = static_cast<iter_difference_t<I1>>(n2);
+					detail::__mismatch_forward(first1, first2, n);
+					return {std::move(first1), std::move(first2)};
+				}
+			}
 			while (true) {
 				if (first1 == last1) break;
 				if (first2 == last2) break;
@@ -12,6 +12,7 @@
 #ifndef STL2_DETAIL_ALGORITHM_MOVE_BACKWARD_HPP
 #define STL2_DETAIL_ALGORITHM_MOVE_BACKWARD_HPP
 
+#include <stl2/detail/algorithm/contiguous.hpp>
 #include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/range/primitives.hpp>
 
@@ -28,6 +29,14 @@ STL2_OPEN_NAMESPACE {
 		requires IndirectlyMovable<I1, I2>
 		constexpr move_backward_result<I1, I2>
 		operator()(I1 first, S1 s, I2 result) const {
+			if constexpr (SizedSentinel<S1, I1> && detail::MemMovable<I1, I2>) {
+				if (!detail::is_constant_evaluated()) {
+					auto n = s - first;
+					detail::__unwrap<I1>::advance(first, n);
+					detail::__memmove_backward(first, n, result);
+					return {std::move(first), std::move(result)};
+				}
+			}
 			auto last = next(first, std::move(s));
 			auto i = last;
 			while (i != first) {
@@ -22,6 +22,8 @@
 #ifndef STL2_DETAIL_ALGORITHM_PARTITION_POINT_HPP
 #define STL2_DETAIL_ALGORITHM_PARTITION_POINT_HPP
 
+#include <memory>
+#include <type_traits>
 #include <stl2/detail/concepts/callable.hpp>
 #include <stl2/detail/iterator/counted_iterator.hpp>
 #include <stl2/detail/range/primitives.hpp>
@@ -30,6 +32,50 @@
 // partition_point [alg.partitions]
 //
 STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// Bisection that selects the next half with a conditional move
+		// instead of a branch pays off when testing an element is a cheap
+		// comparison of scalars: a search then costs its cache misses, but
+		// no mispredictions.
+		template<class I, class Proj>
+		META_CONCEPT __branchless_bisectable = RandomAccessIterator<I> &&
+			std::is_scalar_v<__uncvref<indirect_result_t<Proj&, I>>>;
+
+		// Hint that the element *i will be read soon.
+		template<class I>
+		void __prefetch(const I& i) noexcept {
+			if constexpr (ContiguousIterator<I>) {
+#if defined(__GNUC__) || defined(__clang__)
+				__builtin_prefetch(std::addressof(*i));
+#endif
+			}
+		}
+
+		// The first of the n elements starting at first that does not
+		// satisfy pred. Both elements that the next step may probe are
+		// prefetched while the current probe is compared.
+		template<class I, class Pred, class Proj>
+		requires __branchless_bisectable<I, Proj>
+		constexpr I __branchless_partition_point_n(I first, iter_difference_t<I> n,
+			Pred& pred, Proj& proj)
+		{
+			using D = iter_difference_t<I>;
+			if (n == 0) return first;
+			while (n > 1) {
+				const D half = n / 2;
+				n -= half;
+				if (!is_constant_evaluated()) {
+					__prefetch(first + n / 2);
+					__prefetch(first + (half + n / 2));
+				}
+				const bool right = __stl2::invoke(pred, __stl2::invoke(proj, first[half]));
+				first += right ? half : D{0};
+			}
+			first += __stl2::invoke(pred, __stl2::invoke(proj, *first)) ? D{1} : D{0};
+			return first;
+		}
+	}
+
 	namespace ext {
 		struct __partition_point_n_fn {
 			template<ForwardIterator I, class Proj = identity,
@@ -38,6 +84,10 @@ STL2_OPEN_NAMESPACE {
 				Proj proj = {}) const
 			{
 				STL2_EXPECT(0 <= n);
+				if constexpr (detail::__branchless_bisectable<I, Proj>) {
+					return detail::__branchless_partition_point_n(std::move(first), n,
+						pred, proj);
+				}
 				while (n != 0) {
 					auto const half = n / 2;
 					auto middle = next(ext::uncounted(first), half);
@@ -0,0 +1,336 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_RADIX_SORT_HPP
+#define STL2_DETAIL_ALGORITHM_RADIX_SORT_HPP
+
+#include <climits>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/simd.hpp>
+#include <stl2/detail/temporary_vector.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/algorithm/stable_sort.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/range/primitives.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// radix_sort [Extension]
+//
+// Sorts by the projected keys - which must be integral or IEEE floating
+// point - one byte at a time instead of by comparing them. The order is
+// that of less on the keys, except that -0.0 and +0.0 are equivalent and
+// NaNs sort after (or, with the sign bit set, before) everything else.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template<class K>
+		META_CONCEPT RadixKey =
+			(std::is_integral_v<K> ||
+				(std::is_floating_point_v<K> && std::numeric_limits<K>::is_iec559)) &&
+			requires { typename simd::bits_t<sizeof(K)>; };
+
+		// The unsigned integer whose order is the order of k.
+		template<RadixKey K>
+		constexpr simd::bits_t<sizeof(K)> radix_key(K k) noexcept {
+			using U = simd::bits_t<sizeof(K)>;
+			constexpr U sign = U(1) << (sizeof(K) * CHAR_BIT - 1);
+			if constexpr (std::is_floating_point_v<K>) {
+				U u;
+				std::memcpy(&u, &k, sizeof(u));
+				// -0.0 is +0.0. (Test the bits: -ffast-math folds k == 0 ? 0 : k.)
+				if (u == sign) u = 0;
+				// Negatives order by decreasing magnitude, and before positives.
+				return (u & sign) ? U(~u) : U(u | sign);
+			} else if constexpr (std::is_signed_v<K>) {
+				return static_cast<U>(static_cast<U>(k) ^ sign);
+			} else {
+				return static_cast<U>(k);
+			}
+		}
+
+		template<class I, class Proj>
+		using radix_key_t = __uncvref<indirect_result_t<Proj&, I>>;
+
+		struct rdxsort {
+			static constexpr int radix = 1 << CHAR_BIT;
+			// Below this size, comparison sorting beats another pass.
+			static constexpr std::ptrdiff_t comparison_sort_threshold = 64;
+			// Above this size, LSD passes over the whole input miss cache.
+			static constexpr std::ptrdiff_t bucket_threshold = std::ptrdiff_t{1} << 16;
+
+			template<class I, class Proj>
+			static constexpr auto key(I i, Proj& proj) {
+				return detail::radix_key(__stl2::invoke(proj, *i));
+			}
+
+			template<class U>
+			static constexpr int digit(U u, int byte) noexcept {
+				return static_cast<int>((u >> (byte * CHAR_BIT)) & (radix - 1));
+			}
+
+			// Sort [first, first + n) by key, comparing the keys.
+			template<RandomAccessIterator I, class Proj>
+			static void comparison_sort(I first, iter_difference_t<I> n, Proj& proj) {
+				if constexpr (std::is_integral_v<radix_key_t<I, Proj>>) {
+					// Same order, and sort partitions integers without branching.
+					__stl2::sort(first, first + n, less{}, __stl2::ref(proj));
+				} else {
+					__stl2::sort(first, first + n, less{}, [&proj](auto&& x) {
+						return detail::radix_key(__stl2::invoke(proj, std::forward<decltype(x)>(x)));
+					});
+				}
+			}
+
+			// Turn count - a histogram of one byte of n keys - into the
+			// offset of each digit's first element, and report whether the
+			// byte holds the same value in every key.
+			template<class D>
+			static bool offsets(D* const count, const D n) noexcept {
+				D offset = 0;
+				bool trivial = false;
+				for (int d = 0; d < radix; ++d) {
+					trivial = trivial || count[d] == n;
+					const D c = count[d];
+					count[d] = offset;
+					offset += c;
+				}
+				return trivial;
+			}
+
+			// One stable counting-sort pass per byte below hi that doesn't
+			// hold the same value in every key, moving the n elements back
+			// and forth between first and tmp; they start in tmp if
+			// in_buffer, and end up in first.
+			template<RandomAccessIterator I, class V, class D, class Proj>
+			static void lsd_passes(I first, V* const tmp, const D n,
+				D (*counts)[radix], const int hi, bool in_buffer, Proj& proj)
+			{
+				for (int b = 0; b < hi; ++b) {
+					D* const count = counts[b];
+					if (offsets(count, n)) continue;
+					if (in_buffer) {
+						for (D i = 0; i < n; ++i) {
+							first[count[digit(key(tmp + i, proj), b)]++] = std::move(tmp[i]);
+						}
+					} else {
+						for (D i = 0; i < n; ++i) {
+							tmp[count[digit(key(first + i, proj), b)]++] = iter_move(first + i);
+						}
+					}
+					in_buffer = !in_buffer;
+				}
+				if (in_buffer) {
+					for (D i = 0; i < n; ++i) {
+						first[i] = std::move(tmp[i]);
+					}
+				}
+			}
+
+			// Sort the n elements at first - or at tmp, if in_buffer - by the
+			// bytes of their keys up to hi, stably, leaving them in first.
+			//
+			// Inputs that fit in cache take one counting-sort pass per byte,
+			// least significant first. Out of cache, each such pass scatters
+			// to 256 places far apart, and for wide keys they cost more than
+			// comparison sorting does; instead, split larger inputs into
+			// buckets by the highest byte that varies, and sort each bucket
+			// by the bytes below.
+			template<RandomAccessIterator I, class V, class D, class Proj>
+			static void sort_bytes(I first, V* const tmp, const D n, int hi,
+				bool in_buffer, Proj& proj)
+			{
+				constexpr int bytes = sizeof(radix_key_t<I, Proj>);
+				auto k = [&](D i) {
+					return in_buffer ? key(tmp + i, proj) : key(first + i, proj);
+				};
+				if (n == 1) {
+					if (in_buffer) *first = std::move(*tmp);
+					return;
+				}
+				if (n >= bucket_threshold) {
+					for (; hi > 0; --hi) {
+						// Afterward, end[d] is one past the last element of bucket d.
+						D end[radix] = {};
+						for (D i = 0; i < n; ++i) {
+							++end[digit(k(i), hi)];
+						}
+						if (offsets(end, n)) continue;
+						if (in_buffer) {
+							for (D i = 0; i < n; ++i) {
+								first[end[digit(key(tmp + i, proj), hi)]++] = std::move(tmp[i]);
+							}
+						} else {
+							for (D i = 0; i < n; ++i) {
+								tmp[end[digit(key(first + i, proj), hi)]++] = iter_move(first + i);
+							}
+						}
+						D start = 0;
+						for (int d = 0; d < radix; ++d) {
+							if (end[d] > start) {
+								sort_bytes(first + start, tmp + start, end[d] - start,
+									hi - 1, !in_buffer, proj);
+							}
+							start = end[d];
+						}
+						return;
+					}
+				}
+
+				D counts[bytes][radix] = {};
+				for (D i = 0; i < n; ++i) {
+					const auto x = k(i);
+					for (int b = 0; b <= hi; ++b) {
+						++counts[b][digit(x, b)];
+					}
+				}
+				lsd_passes(first, tmp, n, counts, hi + 1, in_buffer, proj);
+			}
+
+			// Stable radix sort through buf. Returns false - having done
+			// nothing - if buf can't hold n elements.
+			template<RandomAccessIterator I, class Proj>
+			requires Sortable<I, less, Proj>
+			static bool lsd(I first, const iter_difference_t<I> n,
+				temporary_buffer<iter_value_t<I>>& buf, Proj& proj)
+			{
+				constexpr int bytes = sizeof(radix_key_t<I, Proj>);
+				if (buf.size() < n) return false;
+
+				auto vec = detail::make_temporary_vector(buf);
+				for (iter_difference_t<I> i = 0; i < n; ++i) {
+					vec.emplace_back(iter_move(first + i));
+				}
+				sort_bytes(first, vec.begin(), n, bytes - 1, true, proj);
+				return true;
+			}
+
+			// Most-significant-digit first, in place ("American flag sort"):
+			// permute the elements into buckets by byte with cycles of
+			// swaps, then sort each bucket by the following bytes.
+			template<RandomAccessIterator I, class Proj>
+			requires Sortable<I, less, Proj>
+			static void msd(I first, const iter_difference_t<I> n, int byte, Proj& proj) {
+				using D = iter_difference_t<I>;
+				for (; byte >= 0; --byte) {
+					if (n < comparison_sort_threshold) {
+						comparison_sort(first, n, proj);
+						return;
+					}
+					D count[radix] = {};
+					for (D i = 0; i < n; ++i) {
+						++count[digit(key(first + i, proj), byte)];
+					}
+					D next[radix] = {};
+					D end[radix] = {};
+					D offset = 0;
+					bool trivial = false;
+					for (int d = 0; d < radix; ++d) {
+						trivial = trivial || count[d] == n;
+						next[d] = offset;
+						offset += count[d];
+						end[d] = offset;
+					}
+					// All keys share this byte: move on to the next one.
+					if (trivial) continue;
+
+					for (int d = 0; d < radix; ++d) {
+						while (next[d] < end[d]) {
+							const int e = digit(key(first + next[d], proj), byte);
+							if (e == d) {
+								++next[d];
+							} else {
+								iter_swap(first + next[d], first + next[e]++);
+							}
+						}
+					}
+					if (byte > 0) {
+						D start = 0;
+						for (int d = 0; d < radix; ++d) {
+							if (end[d] - start > 1) {
+								msd(first + start, end[d] - start, byte - 1, proj);
+							}
+							start = end[d];
+						}
+					}
+					return;
+				}
+			}
+		};
+	}
+
+	namespace ext {
+		struct __radix_sort_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, class Proj = identity>
+			requires Sortable<I, less, Proj> && detail::RadixKey<detail::radix_key_t<I, Proj>>
+			I operator()(I first, S last_, Proj proj = {}) const {
+				using R = detail::rdxsort;
+				using D = iter_difference_t<I>;
+				constexpr int bytes = sizeof(detail::radix_key_t<I, Proj>);
+				auto last = next(first, std::move(last_));
+				const D n = last - first;
+				if (n < R::comparison_sort_threshold) {
+					R::comparison_sort(first, n, proj);
+					return last;
+				}
+				// LSD's scattering passes beat MSD's swap cycles, but need
+				// somewhere to scatter to; MSD sorts in place.
+				detail::temporary_buffer<iter_value_t<I>> buf{n};
+				if (!R::lsd(first, n, buf, proj)) {
+					R::msd(first, n, bytes - 1, proj);
+				}
+				return last;
+			}
+
+			template<RandomAccessRange R, class Proj = identity>
+			requires Sortable<iterator_t<R>, less, Proj> &&
+				detail::RadixKey<detail::radix_key_t<iterator_t<R>, Proj>>
+			safe_iterator_t<R> operator()(R&& r, Proj proj = {}) const {
+				return (*this)(begin(r), end(r), __stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __radix_sort_fn radix_sort {};
+
+		struct __stable_radix_sort_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, class Proj = identity>
+			requires Sortable<I, less, Proj> && detail::RadixKey<detail::radix_key_t<I, Proj>>
+			I operator()(I first, S last_, Proj proj = {}) const {
+				using R = detail::rdxsort;
+				using D = iter_difference_t<I>;
+				auto last = next(first, std::move(last_));
+				const D n = last - first;
+				if (n >= R::comparison_sort_threshold) {
+					detail::temporary_buffer<iter_value_t<I>> buf{n};
+					if (R::lsd(first, n, buf, proj)) return last;
+				}
+				// No room for LSD's scratch space, or not worth it.
+				return __stl2::stable_sort(first, last, less{}, [&proj](auto&& x) {
+					return detail::radix_key(__stl2::invoke(proj, std::forward<decltype(x)>(x)));
+				});
+			}
+
+			template<RandomAccessRange R, class Proj = identity>
+			requires Sortable<iterator_t<R>, less, Proj> &&
+				detail::RadixKey<detail::radix_key_t<iterator_t<R>, Proj>>
+			safe_iterator_t<R> operator()(R&& r, Proj proj = {}) const {
+				return (*this)(begin(r), end(r), __stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __stable_radix_sort_fn stable_radix_sort {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
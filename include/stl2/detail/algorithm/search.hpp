@@ -23,6 +23,7 @@
 #ifndef STL2_DETAIL_ALGORITHM_SEARCH_HPP
 #define STL2_DETAIL_ALGORITHM_SEARCH_HPP
 
+#include <stl2/detail/algorithm/contiguous.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 #include <stl2/detail/iterator/counted_iterator.hpp>
 #include <stl2/view/subrange.hpp>
@@ -31,6 +32,16 @@
 // search [alg.search]
 //
 STL2_OPEN_NAMESPACE {
+	namespace ext {
+		// A Searcher finds the first occurrence of the pattern it was built
+		// from in a range [Extension]
+		template<class T, class I, class S>
+		META_CONCEPT Searcher = ForwardIterator<I> && Sentinel<S, I> &&
+			requires(const T& searcher, I first, S last) {
+				{ searcher(first, last) } -> Same<subrange<I>>&&;
+			};
+	}
+
 	struct __search_fn : private __niebloid {
 		template<ForwardIterator I1, Sentinel<I1> S1,
 			ForwardIterator I2, Sentinel<I2> S2, class Pred = equal_to,
@@ -39,6 +50,23 @@ STL2_OPEN_NAMESPACE {
 		constexpr subrange<I1> operator()(I1 first1, S1 last1, I2 first2,
 			S2 last2, Pred pred = {}, Proj1 proj1 = {}, Proj2 proj2 = {}) const
 		{
+			if constexpr (SizedSentinel<S1, I1> && SizedSentinel<S2, I2> &&
+				detail::MemComparable<I1, I2, Pred, Proj1, Proj2> &&
+				detail::__byte_haystack<I1, iter_value_t<detail::__unwrap_t<I1>>>)
+			{
+				if (!detail::is_constant_evaluated()) {
+					const auto m = last2 - first2;
+					if (m > 0 && !detail::__memsearch(first1, last1 - first1,
+						detail::__lowest_address<false>(first2, m),
+						static_cast<std::size_t>(m)))
+					{
+						return {first1, first1};
+					}
+					auto end = first1;
+					detail::__unwrap<I1>::advance(end, static_cast<iter_difference_t<I1>>(m));
+					return {std::move(first1), std::move(end)};
+				}
+			}
 			if constexpr (SizedSentinel<S1, I1> && SizedSentinel<S2, I2>) {
 				return sized(first1, last1, last1 - first1,
 					first2, last2, last2 - first2,
@@ -65,6 +93,22 @@ STL2_OPEN_NAMESPACE {
 					__stl2::ref(pred), __stl2::ref(proj1), __stl2::ref(proj2));
 			}
 		}
+
+		// Extension
+		template<ForwardIterator I, Sentinel<I> S, class Searcher>
+		requires ext::Searcher<Searcher, I, S>
+		constexpr subrange<I>
+		operator()(I first, S last, const Searcher& searcher) const {
+			return searcher(std::move(first), std::move(last));
+		}
+
+		// Extension
+		template<ForwardRange R, class Searcher>
+		requires ext::Searcher<Searcher, iterator_t<R>, sentinel_t<R>>
+		constexpr safe_subrange_t<R>
+		operator()(R&& r, const Searcher& searcher) const {
+			return searcher(begin(r), end(r));
+		}
 	private:
 		template<ForwardIterator I1, Sentinel<I1> S1,
 			ForwardIterator I2, Sentinel<I2> S2, class Pred = equal_to,
@@ -0,0 +1,287 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_SEARCHERS_HPP
+#define STL2_DETAIL_ALGORITHM_SEARCHERS_HPP
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/simd.hpp>
+#include <stl2/detail/algorithm/contiguous.hpp>
+#include <stl2/detail/algorithm/search.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/operations.hpp>
+#include <stl2/view/subrange.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Searchers [Extension]
+//
+// A searcher preprocesses a pattern once, when it is constructed, and then
+// finds that pattern in any number of haystacks via search(haystack,
+// searcher). As with the std searchers, the pattern is not copied and must
+// outlive the searcher.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// Elements of type T compared with Pred can index a table of
+		// 1 << CHAR_BIT entries.
+		template<class T, class Pred>
+		META_CONCEPT __byte_key =
+			std::is_integral_v<T> && sizeof(T) == 1 &&
+			Same<__uncvref<__stl2::__unwrap<Pred>>, equal_to>;
+	}
+
+	namespace ext {
+		///////////////////////////////////////////////////////////////////////////
+		// boyer_moore_horspool_searcher
+		//
+		// Compares the pattern right-to-left against the haystack and, on a
+		// mismatch, shifts by the distance from the haystack element under
+		// the pattern's end to that element's last occurrence in the pattern.
+		// Sublinear on typical input; O(N * M) in the worst case.
+		//
+		template<RandomAccessIterator I, class Hash = std::hash<iter_value_t<I>>,
+			class Pred = equal_to>
+		requires IndirectRelation<const Pred, I>
+		class boyer_moore_horspool_searcher {
+			using D = iter_difference_t<I>;
+			using table_t = meta::if_c<detail::__byte_key<iter_value_t<I>, Pred>,
+				std::array<D, 1 << CHAR_BIT>,
+				std::unordered_map<iter_value_t<I>, D, Hash, Pred>>;
+
+			I first_;
+			D size_;
+			Pred pred_;
+			table_t table_;
+
+			static table_t make_table(const I& first, const D size, Hash& hash, const Pred& pred) {
+				if constexpr (detail::__byte_key<iter_value_t<I>, Pred>) {
+					table_t table;
+					table.fill(size);
+					for (D i = 0; i < size - 1; ++i) {
+						table[static_cast<unsigned char>(first[i])] = size - 1 - i;
+					}
+					return table;
+				} else {
+					table_t table(static_cast<std::size_t>(size), std::move(hash), pred);
+					for (D i = 0; i < size - 1; ++i) {
+						table.insert_or_assign(first[i], size - 1 - i);
+					}
+					return table;
+				}
+			}
+
+			D shift(const iter_value_t<I>& x) const {
+				if constexpr (detail::__byte_key<iter_value_t<I>, Pred>) {
+					return table_[static_cast<unsigned char>(x)];
+				} else {
+					const auto pos = table_.find(x);
+					return pos == table_.end() ? size_ : pos->second;
+				}
+			}
+		public:
+			template<Sentinel<I> S>
+			boyer_moore_horspool_searcher(I first, S last,
+				Hash hash = Hash{}, Pred pred = Pred{})
+			: first_(first), size_(__stl2::distance(first, std::move(last)))
+			, pred_(std::move(pred))
+			, table_(make_table(first_, size_, hash, pred_))
+			{}
+
+			template<RandomAccessIterator I1, Sentinel<I1> S1>
+			requires Same<iter_value_t<I1>, iter_value_t<I>> &&
+				IndirectRelation<const Pred, I1, I>
+			subrange<I1> operator()(I1 first, S1 last) const {
+				auto end = __stl2::next(first, std::move(last));
+				if (size_ == 0) return {first, first};
+				const auto m = static_cast<iter_difference_t<I1>>(size_);
+				for (auto n = end - first; n >= m;) {
+					D j = size_ - 1;
+					while (__stl2::invoke(pred_, first[j], first_[j])) {
+						if (j == 0) return {first, first + m};
+						--j;
+					}
+					const auto s = static_cast<iter_difference_t<I1>>(shift(first[m - 1]));
+					first += s;
+					n -= s;
+				}
+				return {end, end};
+			}
+		};
+
+		template<RandomAccessIterator I, Sentinel<I> S>
+		boyer_moore_horspool_searcher(I, S) -> boyer_moore_horspool_searcher<I>;
+		template<RandomAccessIterator I, Sentinel<I> S, class Hash>
+		boyer_moore_horspool_searcher(I, S, Hash) ->
+			boyer_moore_horspool_searcher<I, Hash>;
+		template<RandomAccessIterator I, Sentinel<I> S, class Hash, class Pred>
+		boyer_moore_horspool_searcher(I, S, Hash, Pred) ->
+			boyer_moore_horspool_searcher<I, Hash, Pred>;
+
+		///////////////////////////////////////////////////////////////////////////
+		// two_way_searcher
+		//
+		// Crochemore and Perrin's two-way algorithm: splits the pattern at a
+		// critical factorization, matches the right part left-to-right, and
+		// then the left part right-to-left. O(N + M) time and O(1) space in
+		// the worst case. Elements match when they are equivalent under Comp.
+		//
+		template<RandomAccessIterator I, class Comp = less>
+		requires IndirectStrictWeakOrder<const Comp, I>
+		class two_way_searcher {
+			using D = iter_difference_t<I>;
+
+			I first_;
+			D size_;
+			Comp comp_;
+			D split_ = 0;  // The right part of the factorization starts here.
+			D period_ = 1; // How far to shift after a full match of the right part.
+			D memory_ = 0; // How many elements that shift leaves known to match.
+
+			template<class T, class U>
+			bool equivalent(T&& t, U&& u) const {
+				return !__stl2::invoke(comp_, t, u) && !__stl2::invoke(comp_, u, t);
+			}
+
+			// The start and period of the pattern's maximal suffix under
+			// Comp, or under its reverse if Reversed.
+			template<bool Reversed>
+			std::pair<D, D> maximal_suffix() const {
+				D i = -1, j = 0, k = 1, p = 1;
+				while (j + k < size_) {
+					auto&& a = first_[i + k];
+					auto&& b = first_[j + k];
+					if (Reversed ? __stl2::invoke(comp_, a, b) : __stl2::invoke(comp_, b, a)) {
+						j += k;
+						k = 1;
+						p = j - i;
+					} else if (Reversed ? __stl2::invoke(comp_, b, a) : __stl2::invoke(comp_, a, b)) {
+						i = j++;
+						k = p = 1;
+					} else if (k == p) {
+						j += p;
+						k = 1;
+					} else {
+						++k;
+					}
+				}
+				return {i + 1, p};
+			}
+		public:
+			template<Sentinel<I> S>
+			two_way_searcher(I first, S last, Comp comp = Comp{})
+			: first_(first), size_(__stl2::distance(first, std::move(last)))
+			, comp_(std::move(comp))
+			{
+				if (size_ == 0) return;
+				const auto [s1, p1] = maximal_suffix<false>();
+				const auto [s2, p2] = maximal_suffix<true>();
+				D p;
+				if (s1 >= s2) {
+					split_ = s1;
+					p = p1;
+				} else {
+					split_ = s2;
+					p = p2;
+				}
+				// Is the pattern periodic, with the left part repeating at p?
+				D i = 0;
+				while (i < split_ && equivalent(first_[i], first_[i + p])) ++i;
+				if (i == split_) {
+					period_ = p;
+					memory_ = size_ - p;
+				} else {
+					period_ = (split_ > size_ - split_ ? split_ : size_ - split_) + 1;
+					memory_ = 0;
+				}
+			}
+
+			template<RandomAccessIterator I1, Sentinel<I1> S1>
+			requires IndirectStrictWeakOrder<const Comp, I1, I>
+			subrange<I1> operator()(I1 first, S1 last) const {
+				auto end = __stl2::next(first, std::move(last));
+				if (size_ == 0) return {first, first};
+				const auto m = static_cast<iter_difference_t<I1>>(size_);
+				D memory = 0;
+				while (end - first >= m) {
+					// Match the right part...
+					D k = split_ > memory ? split_ : memory;
+					while (k < size_ && equivalent(first[k], first_[k])) ++k;
+					if (k < size_) {
+						first += static_cast<iter_difference_t<I1>>(k - split_ + 1);
+						memory = 0;
+						continue;
+					}
+					// ...then the left part.
+					k = split_;
+					while (k > memory && equivalent(first[k - 1], first_[k - 1])) --k;
+					if (k <= memory) return {first, first + m};
+					first += static_cast<iter_difference_t<I1>>(period_);
+					memory = memory_;
+				}
+				return {end, end};
+			}
+		};
+
+		template<RandomAccessIterator I, Sentinel<I> S>
+		two_way_searcher(I, S) -> two_way_searcher<I>;
+		template<RandomAccessIterator I, Sentinel<I> S, class Comp>
+		two_way_searcher(I, S, Comp) -> two_way_searcher<I, Comp>;
+
+		///////////////////////////////////////////////////////////////////////////
+		// byte_searcher
+		//
+		// Finds a pattern of bytes in contiguous storage by testing a vector
+		// of candidate positions at a time for both the pattern's first and
+		// last bytes, and comparing the bytes in between only where both match.
+		//
+		template<ContiguousIterator I>
+		requires detail::simd::__searchable<iter_value_t<I>> &&
+			(sizeof(iter_value_t<I>) == 1)
+		class byte_searcher {
+			using V = iter_value_t<I>;
+
+			const V* pattern_ = nullptr;
+			std::size_t size_ = 0;
+		public:
+			template<SizedSentinel<I> S>
+			byte_searcher(I first, S last)
+			: size_(static_cast<std::size_t>(last - first))
+			{
+				if (size_ != 0) pattern_ = std::addressof(*first);
+			}
+
+			template<ForwardIterator I1, SizedSentinel<I1> S1>
+			requires detail::__byte_haystack<I1, V>
+			subrange<I1> operator()(I1 first, S1 last) const {
+				if (!detail::__memsearch(first, last - first, pattern_, size_)) {
+					return {first, first};
+				}
+				auto end = first;
+				detail::__unwrap<I1>::advance(end, static_cast<iter_difference_t<I1>>(size_));
+				return {std::move(first), std::move(end)};
+			}
+		};
+
+		template<ContiguousIterator I, SizedSentinel<I> S>
+		byte_searcher(I, S) -> byte_searcher<I>;
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -13,9 +13,14 @@
 #ifndef STL2_DETAIL_ALGORITHM_SORT_HPP
 #define STL2_DETAIL_ALGORITHM_SORT_HPP
 
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <stl2/functional.hpp>
 #include <stl2/detail/algorithm/forward_sort.hpp>
-#include <stl2/detail/algorithm/random_access_sort.hpp>
+#include <stl2/detail/algorithm/partial_sort.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution.hpp>
 #include <stl2/detail/range/primitives.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -34,8 +39,8 @@ STL2_OPEN_NAMESPACE {
 				if (first == sent) return first;
 				auto last = next(first, std::move(sent));
 				auto n = distance(first, last);
-				introsort_loop(first, last, log2(n) * 2, comp, proj);
-				final_insertion_sort(first, last, comp, proj);
+				pdqsort_loop<branchless<I, Comp, Proj>>(
+					first, last, log2(n), true, comp, proj);
 				return last;
 			} else {
 				auto n = distance(first, std::move(sent));
@@ -51,83 +56,389 @@ STL2_OPEN_NAMESPACE {
 		operator()(R&& r, Comp comp = {}, Proj proj = {}) const {
 			return (*this)(begin(r), end(r), std::move(comp), std::move(proj));
 		}
+
+		/// Extension: execution policies. Quicksort, sorting the parts of
+		/// each partition concurrently.
+		///
+		template<ext::ExecutionPolicy EP, RandomAccessIterator I, SizedSentinel<I> S,
+			class Comp = less, class Proj = identity>
+		requires Sortable<I, Comp, Proj>
+		I operator()(EP&& policy, I first, S sent, Comp comp = {}, Proj proj = {}) const {
+			auto last = first + iter_difference_t<I>(sent - first);
+			if constexpr (detail::__parallel_policy<EP>) {
+				auto& pool = policy.pool();
+				const auto n = last - first;
+				if (n > parallel_threshold && pool.concurrency() > 1) {
+					detail::task_group group{pool};
+					pdqsort_loop<branchless<I, Comp, Proj>>(
+						first, last, log2(n), true, comp, proj, &group);
+					group.wait();
+					return last;
+				}
+			}
+			return (*this)(std::move(first), last, __stl2::ref(comp), __stl2::ref(proj));
+		}
+
+		template<ext::ExecutionPolicy EP, detail::__parallel_range R,
+			class Comp = less, class Proj = identity>
+		requires Sortable<iterator_t<R>, Comp, Proj>
+		safe_iterator_t<R>
+		operator()(EP&& policy, R&& r, Comp comp = {}, Proj proj = {}) const {
+			return (*this)(std::forward<EP>(policy), begin(r), end(r),
+				__stl2::ref(comp), __stl2::ref(proj));
+		}
 	private:
-		static constexpr std::ptrdiff_t introsort_threshold = 16;
+		// Pattern-defeating quicksort (Orson Peters, 2021): introsort with
+		// ninther pivots, detection of already-partitioned runs, a separate
+		// partition for runs of elements equal to the pivot, and shuffles
+		// that break up adversarial patterns before giving up on quicksort.
+		static constexpr std::ptrdiff_t insertion_sort_threshold = 24;
+		static constexpr std::ptrdiff_t ninther_threshold = 128;
+		static constexpr std::ptrdiff_t partial_insertion_sort_limit = 8;
+		static constexpr std::ptrdiff_t block_size = 64;
+		// The smallest part worth sorting on another thread.
+		static constexpr std::ptrdiff_t parallel_threshold = 1 << 14;
+
+		// Comparisons so cheap that it's faster to partition a block at a
+		// time without branching on their results.
+		template<class I, class Comp, class Proj>
+		static constexpr bool branchless =
+			std::is_arithmetic_v<iter_value_t<I>> &&
+			Same<__uncvref<__stl2::__unwrap<Proj>>, identity> &&
+			(Same<__uncvref<__stl2::__unwrap<Comp>>, less> ||
+				Same<__uncvref<__stl2::__unwrap<Comp>>, greater> ||
+				Same<__uncvref<__stl2::__unwrap<Comp>>, std::less<>> ||
+				Same<__uncvref<__stl2::__unwrap<Comp>>, std::greater<>> ||
+				Same<__uncvref<__stl2::__unwrap<Comp>>, std::less<iter_value_t<I>>> ||
+				Same<__uncvref<__stl2::__unwrap<Comp>>, std::greater<iter_value_t<I>>>);
+
+		template<class Comp, class Proj, class T, class U>
+		static constexpr bool
+		lt(Comp& comp, Proj& proj, T&& t, U&& u) {
+			return __stl2::invoke(comp,
+				__stl2::invoke(proj, std::forward<T>(t)),
+				__stl2::invoke(proj, std::forward<U>(u)));
+		}
 
 		template<RandomAccessIterator I, class Comp, class Proj>
 		requires Sortable<I, Comp, Proj>
-		static constexpr I
-		choose_pivot(I first, I last, Comp& comp, Proj& proj) {
-			STL2_EXPECT(first != last);
-			I mid = first + iter_difference_t<I>(last - first) / 2;
-			--last;
-			// Find the median:
-			return [&](auto&& a, auto&& b, auto&& c) {
-				return __stl2::invoke(comp, a, b)
-					? (__stl2::invoke(comp, b, c) ? mid   : (__stl2::invoke(comp, a, c) ? last : first))
-					: (__stl2::invoke(comp, a, c) ? first : (__stl2::invoke(comp, b, c) ? last : mid  ));
-			}(__stl2::invoke(proj, *first), __stl2::invoke(proj, *mid), __stl2::invoke(proj, *last));
+		static constexpr void
+		sort2(I a, I b, Comp& comp, Proj& proj) {
+			if (lt(comp, proj, *b, *a)) iter_swap(a, b);
 		}
 
 		template<RandomAccessIterator I, class Comp, class Proj>
 		requires Sortable<I, Comp, Proj>
-		static constexpr I
-		unguarded_partition(I first, I last, Comp& comp, Proj& proj) {
-			I pivot_pnt = choose_pivot(first, last, comp, proj);
+		static constexpr void
+		sort3(I a, I b, I c, Comp& comp, Proj& proj) {
+			sort2(a, b, comp, proj);
+			sort2(b, c, comp, proj);
+			sort2(a, b, comp, proj);
+		}
 
-			// Do the partition:
-			while (true) {
-				auto&& v = *pivot_pnt;
-				auto&& pivot = __stl2::invoke(proj, std::forward<decltype(v)>(v));
-				while (__stl2::invoke(comp, __stl2::invoke(proj, *first), pivot)) {
-					++first;
-				}
-				while (__stl2::invoke(comp, pivot, __stl2::invoke(proj, *--last))) {
-					; // do nothing
-				}
-				if (!(first < last)) {
-					return first;
+		// Insertion sort [first, last), and report whether that took fewer
+		// than partial_insertion_sort_limit moves - giving up if not, when
+		// Partial. Guarded is false when some element before first is no
+		// greater than any element of [first, last).
+		template<bool Guarded, bool Partial, RandomAccessIterator I,
+			class Comp, class Proj>
+		requires Sortable<I, Comp, Proj>
+		static constexpr bool
+		insertion_sort(I first, I last, Comp& comp, Proj& proj) {
+			if (first == last) return true;
+			iter_difference_t<I> moves = 0;
+			for (I cur = first + 1; cur != last; ++cur) {
+				I sift = cur;
+				I sift_1 = cur - 1;
+				if (lt(comp, proj, *sift, *sift_1)) {
+					iter_value_t<I> tmp = iter_move(sift);
+					do {
+						*sift = iter_move(sift_1);
+						--sift;
+					} while ((!Guarded || sift != first) &&
+						lt(comp, proj, tmp, *--sift_1));
+					*sift = std::move(tmp);
+					moves += cur - sift;
 				}
-				iter_swap(first, last);
-				pivot_pnt = pivot_pnt == first ? last : (pivot_pnt == last ? first : pivot_pnt);
-				++first;
+				if (Partial && moves > partial_insertion_sort_limit) return false;
 			}
+			return true;
 		}
 
+		// Partition [first, last) around *first into elements less than it
+		// and elements not less than it, and return the pivot's final
+		// position and whether the range was already so partitioned.
+		// Requires an element not less than the pivot after first.
 		template<RandomAccessIterator I, class Comp, class Proj>
 		requires Sortable<I, Comp, Proj>
+		static constexpr std::pair<I, bool>
+		partition_right(const I begin, const I end, Comp& comp, Proj& proj) {
+			iter_value_t<I> pivot = iter_move(begin);
+			I first = begin;
+			I last = end;
+			while (lt(comp, proj, *++first, pivot));
+			if (first - 1 == begin) {
+				while (first < last && !lt(comp, proj, *--last, pivot));
+			} else {
+				while (!lt(comp, proj, *--last, pivot));
+			}
+			const bool already_partitioned = first >= last;
+			while (first < last) {
+				iter_swap(first, last);
+				while (lt(comp, proj, *++first, pivot));
+				while (!lt(comp, proj, *--last, pivot));
+			}
+			I pivot_pos = first - 1;
+			*begin = iter_move(pivot_pos);
+			*pivot_pos = std::move(pivot);
+			return {pivot_pos, already_partitioned};
+		}
+
+		// Swap the elements at first + offsets_l[i] with those at
+		// last - offsets_r[i] for i in [0, n), as a cycle of moves unless
+		// swaps are needed to keep the elements in place.
+		template<RandomAccessIterator I>
+		requires Permutable<I>
 		static constexpr void
-		introsort_loop(I first, I last, iter_difference_t<I> depth_limit, Comp& comp, Proj& proj)
+		swap_offsets(I first, I last, const unsigned char* offsets_l,
+			const unsigned char* offsets_r, std::ptrdiff_t n, bool use_swaps)
 		{
-			while (distance(first, last) > introsort_threshold) {
-				if (depth_limit == 0) {
-					partial_sort(first, last, last, __stl2::ref(comp), __stl2::ref(proj));
-					return;
+			if (use_swaps) {
+				for (std::ptrdiff_t i = 0; i < n; ++i) {
+					iter_swap(first + offsets_l[i], last - offsets_r[i]);
+				}
+			} else if (n > 0) {
+				I l = first + offsets_l[0];
+				I r = last - offsets_r[0];
+				iter_value_t<I> tmp = iter_move(l);
+				*l = iter_move(r);
+				for (std::ptrdiff_t i = 1; i < n; ++i) {
+					l = first + offsets_l[i];
+					*r = iter_move(l);
+					r = last - offsets_r[i];
+					*l = iter_move(r);
 				}
-				I cut = unguarded_partition(first, last, comp, proj);
-				introsort_loop(cut, last, --depth_limit, comp, proj);
-				last = cut;
+				*r = std::move(tmp);
 			}
 		}
 
-		template<BidirectionalIterator I, class Comp, class Proj>
+		// partition_right, but classifying a block of elements from each
+		// end at a time into buffers of offsets without branching on the
+		// comparisons, and then swapping the misplaced ones pairwise.
+		template<RandomAccessIterator I, class Comp, class Proj>
 		requires Sortable<I, Comp, Proj>
-		static constexpr void
-		unguarded_insertion_sort(I first, I last, Comp& comp, Proj& proj) {
-			for (I i = first; i != last; ++i) {
-				detail::rsort::unguarded_linear_insert(i, iter_move(i), comp, proj);
+		static constexpr std::pair<I, bool>
+		partition_right_branchless(const I begin, const I end, Comp& comp, Proj& proj) {
+			iter_value_t<I> pivot = iter_move(begin);
+			I first = begin;
+			I last = end;
+			while (lt(comp, proj, *++first, pivot));
+			if (first - 1 == begin) {
+				while (first < last && !lt(comp, proj, *--last, pivot));
+			} else {
+				while (!lt(comp, proj, *--last, pivot));
 			}
+			const bool already_partitioned = first >= last;
+			if (!already_partitioned) {
+				iter_swap(first, last);
+				++first;
+
+				alignas(64) unsigned char offsets_l[block_size] = {};
+				alignas(64) unsigned char offsets_r[block_size] = {};
+				I offsets_l_base = first;
+				I offsets_r_base = last;
+				std::ptrdiff_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+				while (first < last) {
+					// Fill whichever offset buffers are empty, splitting the
+					// unknown elements between them if both are.
+					const std::ptrdiff_t num_unknown = last - first;
+					const std::ptrdiff_t left_split =
+						num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+					const std::ptrdiff_t right_split =
+						num_r == 0 ? (num_unknown - left_split) : 0;
+					const std::ptrdiff_t left_n = left_split < block_size ? left_split : block_size;
+					for (std::ptrdiff_t i = 0; i < left_n; ++i, ++first) {
+						offsets_l[num_l] = static_cast<unsigned char>(i);
+						num_l += !lt(comp, proj, *first, pivot);
+					}
+					const std::ptrdiff_t right_n = right_split < block_size ? right_split : block_size;
+					for (std::ptrdiff_t i = 0; i < right_n;) {
+						offsets_r[num_r] = static_cast<unsigned char>(++i);
+						num_r += lt(comp, proj, *--last, pivot);
+					}
+
+					const std::ptrdiff_t n = num_l < num_r ? num_l : num_r;
+					swap_offsets(offsets_l_base, offsets_r_base,
+						offsets_l + start_l, offsets_r + start_r, n, num_l == num_r);
+					num_l -= n;
+					num_r -= n;
+					start_l += n;
+					start_r += n;
+					if (num_l == 0) {
+						start_l = 0;
+						offsets_l_base = first;
+					}
+					if (num_r == 0) {
+						start_r = 0;
+						offsets_r_base = last;
+					}
+				}
+
+				// At most one of the buffers still holds misplaced elements:
+				// move them to the boundary.
+				if (num_l) {
+					while (num_l--) {
+						iter_swap(offsets_l_base + offsets_l[start_l + num_l], --last);
+					}
+					first = last;
+				}
+				if (num_r) {
+					while (num_r--) {
+						iter_swap(offsets_r_base - offsets_r[start_r + num_r], first);
+						++first;
+					}
+					last = first;
+				}
+			}
+			I pivot_pos = first - 1;
+			*begin = iter_move(pivot_pos);
+			*pivot_pos = std::move(pivot);
+			return {pivot_pos, already_partitioned};
 		}
 
+		// Partition [first, last) around *first into elements equal to it
+		// and elements greater than it, and return the pivot's final
+		// position. Used when the element before first - a previous pivot -
+		// is not less than *first, so no element is less than *first.
 		template<RandomAccessIterator I, class Comp, class Proj>
 		requires Sortable<I, Comp, Proj>
-		static constexpr void
-		final_insertion_sort(I first, I last, Comp &comp, Proj &proj) {
-			if (distance(first, last) > introsort_threshold) {
-				detail::rsort::insertion_sort(first, first + introsort_threshold, comp, proj);
-				unguarded_insertion_sort(first + introsort_threshold, last, comp, proj);
+		static constexpr I
+		partition_left(const I begin, const I end, Comp& comp, Proj& proj) {
+			iter_value_t<I> pivot = iter_move(begin);
+			I first = begin;
+			I last = end;
+			while (lt(comp, proj, pivot, *--last));
+			if (last + 1 == end) {
+				while (first < last && !lt(comp, proj, pivot, *++first));
 			} else {
-				detail::rsort::insertion_sort(first, last, comp, proj);
+				while (!lt(comp, proj, pivot, *++first));
+			}
+			while (first < last) {
+				iter_swap(first, last);
+				while (lt(comp, proj, pivot, *--last));
+				while (!lt(comp, proj, pivot, *++first));
+			}
+			I pivot_pos = last;
+			*begin = iter_move(pivot_pos);
+			*pivot_pos = std::move(pivot);
+			return pivot_pos;
+		}
+
+		// Sort [first, last) given that leftmost, or that the element
+		// before first is no greater than any of them. bad_allowed counts
+		// down the highly unbalanced partitions tolerated before falling
+		// back to heapsort. Given a group, left parts of more than
+		// parallel_threshold elements are sorted by tasks of that group.
+		template<bool Branchless, RandomAccessIterator I, class Comp, class Proj>
+		requires Sortable<I, Comp, Proj>
+		static constexpr void
+		pdqsort_loop(I first, I last, iter_difference_t<I> bad_allowed,
+			bool leftmost, Comp& comp, Proj& proj, detail::task_group* group = nullptr)
+		{
+			using D = iter_difference_t<I>;
+			while (true) {
+				const D size = last - first;
+				if (size < insertion_sort_threshold) {
+					if (leftmost) {
+						insertion_sort<true, false>(first, last, comp, proj);
+					} else {
+						insertion_sort<false, false>(first, last, comp, proj);
+					}
+					return;
+				}
+
+				// Move the median of three - or of three medians of three -
+				// to first.
+				const D s2 = size / 2;
+				if (size > ninther_threshold) {
+					sort3(first, first + s2, last - 1, comp, proj);
+					sort3(first + 1, first + (s2 - 1), last - 2, comp, proj);
+					sort3(first + 2, first + (s2 + 1), last - 3, comp, proj);
+					sort3(first + (s2 - 1), first + s2, first + (s2 + 1), comp, proj);
+					iter_swap(first, first + s2);
+				} else {
+					sort3(first + s2, first, last - 1, comp, proj);
+				}
+
+				// If the pivot equals the previous pivot, everything equal
+				// to it is in place: partition them off and skip over them.
+				if (!leftmost && !lt(comp, proj, *(first - 1), *first)) {
+					first = partition_left(first, last, comp, proj) + 1;
+					continue;
+				}
+
+				// Plain locals rather than a structured binding, which the
+				// task below could not capture.
+				const auto part = [&] {
+					if constexpr (Branchless) {
+						return partition_right_branchless(first, last, comp, proj);
+					} else {
+						return partition_right(first, last, comp, proj);
+					}
+				}();
+				const I pivot_pos = part.first;
+				const bool already_partitioned = part.second;
+
+				const D l_size = pivot_pos - first;
+				const D r_size = last - (pivot_pos + 1);
+				if (l_size < size / 8 || r_size < size / 8) {
+					// Highly unbalanced: give up after too many of these, and
+					// otherwise shuffle some elements to break up patterns.
+					if (--bad_allowed == 0) {
+						partial_sort(first, last, last, __stl2::ref(comp), __stl2::ref(proj));
+						return;
+					}
+					if (l_size >= insertion_sort_threshold) {
+						iter_swap(first, first + l_size / 4);
+						iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+						if (l_size > ninther_threshold) {
+							iter_swap(first + 1, first + (l_size / 4 + 1));
+							iter_swap(first + 2, first + (l_size / 4 + 2));
+							iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+							iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+						}
+					}
+					if (r_size >= insertion_sort_threshold) {
+						iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+						iter_swap(last - 1, last - r_size / 4);
+						if (r_size > ninther_threshold) {
+							iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+							iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+							iter_swap(last - 2, last - (1 + r_size / 4));
+							iter_swap(last - 3, last - (2 + r_size / 4));
+						}
+					}
+				} else if (already_partitioned &&
+					insertion_sort<true, true>(first, pivot_pos, comp, proj) &&
+					insertion_sort<false, true>(pivot_pos + 1, last, comp, proj))
+				{
+					// A partition that moved nothing suggests the input is
+					// (nearly) sorted; if so, insertion sort just finished it.
+					return;
+				}
+
+				// Recurse into the left part and iterate on the right.
+				if (group && l_size > parallel_threshold) {
+					group->run([=, &comp, &proj] {
+						pdqsort_loop<Branchless>(first, pivot_pos, bad_allowed, leftmost,
+							comp, proj, group);
+					});
+				} else {
+					pdqsort_loop<Branchless>(first, pivot_pos, bad_allowed, leftmost,
+						comp, proj, group);
+				}
+				first = pivot_pos + 1;
+				leftmost = false;
 			}
 		}
 
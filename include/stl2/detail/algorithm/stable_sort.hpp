@@ -35,12 +35,18 @@
 #ifndef STL2_DETAIL_ALGORITHM_STABLE_SORT_HPP
 #define STL2_DETAIL_ALGORITHM_STABLE_SORT_HPP
 
+#include <type_traits>
+#include <vector>
+#include <stl2/detail/algorithm/for_each.hpp>
 #include <stl2/detail/algorithm/forward_sort.hpp>
 #include <stl2/detail/algorithm/inplace_merge.hpp>
 #include <stl2/detail/algorithm/merge.hpp>
 #include <stl2/detail/algorithm/min.hpp>
+#include <stl2/detail/algorithm/move.hpp>
 #include <stl2/detail/algorithm/random_access_sort.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution.hpp>
+#include <stl2/detail/temporary_vector.hpp>
 #include <stl2/detail/iterator/insert_iterators.hpp>
 #include <stl2/detail/iterator/move_iterator.hpp>
 #include <stl2/detail/range/primitives.hpp>
@@ -56,13 +62,7 @@ STL2_OPEN_NAMESPACE {
 		I operator()(I first, S&& last_, Comp comp = {}, Proj proj = {}) const {
 			if constexpr (RandomAccessIterator<I>) {
 				auto last = next(first, std::forward<S>(last_));
-				auto len = iter_difference_t<I>(last - first);
-				auto buf = len > 256 ? buf_t<I>{len} : buf_t<I>{};
-				if (!buf.size_) {
-					inplace_stable_sort(first, last, comp, proj);
-				} else {
-					stable_sort_adaptive(first, last, buf, comp, proj);
-				}
+				random_access_sort(first, last, nullptr, comp, proj);
 				return last;
 			} else {
 				auto n = distance(first, std::forward<S>(last_));
@@ -83,10 +83,240 @@ STL2_OPEN_NAMESPACE {
 					__stl2::ref(proj));
 			}
 		}
+
+		// Extension: sorts with the caller's scratch space. (Otherwise,
+		// stable_sort borrows scratch space that the calling thread keeps
+		// between calls, or allocates when a sort further up the stack
+		// holds that.)
+		template<RandomAccessIterator I, Sentinel<I> S, class Comp = less,
+			class Proj = identity>
+		requires Sortable<I, Comp, Proj>
+		I operator()(I first, S last_, ext::scratch_buffer& scratch,
+			Comp comp = {}, Proj proj = {}) const
+		{
+			auto last = next(first, std::move(last_));
+			random_access_sort(first, last, &scratch, comp, proj);
+			return last;
+		}
+
+		template<RandomAccessRange R, class Comp = less, class Proj = identity>
+		requires Sortable<iterator_t<R>, Comp, Proj>
+		safe_iterator_t<R> operator()(R&& r, ext::scratch_buffer& scratch,
+			Comp comp = {}, Proj proj = {}) const
+		{
+			return (*this)(begin(r), end(r), scratch, __stl2::ref(comp),
+				__stl2::ref(proj));
+		}
+
+		// Extension: execution policies. Merge sort: sort runs concurrently,
+		// and then merge pairs of runs, splitting each merge among the
+		// threads.
+		template<ext::ExecutionPolicy EP, RandomAccessIterator I, SizedSentinel<I> S,
+			class Comp = less, class Proj = identity>
+		requires Sortable<I, Comp, Proj>
+		I operator()(EP&& policy, I first, S last, Comp comp = {}, Proj proj = {}) const {
+			return policy_sort(policy, first, first + iter_difference_t<I>(last - first),
+				nullptr, comp, proj);
+		}
+
+		template<ext::ExecutionPolicy EP, detail::__parallel_range R,
+			class Comp = less, class Proj = identity>
+		requires Sortable<iterator_t<R>, Comp, Proj>
+		safe_iterator_t<R>
+		operator()(EP&& policy, R&& r, Comp comp = {}, Proj proj = {}) const {
+			return (*this)(std::forward<EP>(policy), begin(r), end(r),
+				__stl2::ref(comp), __stl2::ref(proj));
+		}
+
+		template<ext::ExecutionPolicy EP, RandomAccessIterator I, SizedSentinel<I> S,
+			class Comp = less, class Proj = identity>
+		requires Sortable<I, Comp, Proj>
+		I operator()(EP&& policy, I first, S last, ext::scratch_buffer& scratch,
+			Comp comp = {}, Proj proj = {}) const
+		{
+			return policy_sort(policy, first, first + iter_difference_t<I>(last - first),
+				&scratch, comp, proj);
+		}
+
+		template<ext::ExecutionPolicy EP, detail::__parallel_range R,
+			class Comp = less, class Proj = identity>
+		requires Sortable<iterator_t<R>, Comp, Proj>
+		safe_iterator_t<R> operator()(EP&& policy, R&& r, ext::scratch_buffer& scratch,
+			Comp comp = {}, Proj proj = {}) const
+		{
+			return (*this)(std::forward<EP>(policy), begin(r), end(r), scratch,
+				__stl2::ref(comp), __stl2::ref(proj));
+		}
 	private:
 		template<class I>
 		using buf_t = detail::temporary_buffer<iter_value_t<I>>;
 
+		// The shortest run worth sorting on another thread.
+		static constexpr std::ptrdiff_t parallel_threshold = 1 << 14;
+
+		// Sort with scratch space from scratch, or else the calling thread's
+		// own, or else a temporary buffer.
+		template<RandomAccessIterator I, class C, class P>
+		requires Sortable<I, C, P>
+		static void random_access_sort(I first, I last, ext::scratch_buffer* scratch,
+			C& comp, P& proj)
+		{
+			const auto len = iter_difference_t<I>(last - first);
+			if (len <= 256) {
+				inplace_stable_sort(first, last, comp, proj);
+				return;
+			}
+			detail::scratch_lease lease{!scratch};
+			if (!scratch) scratch = lease.get();
+			auto buf = detail::scratch_or_temporary_buffer<iter_value_t<I>>(scratch, len);
+			if (!buf.size()) {
+				inplace_stable_sort(first, last, comp, proj);
+			} else {
+				stable_sort_adaptive(first, last, buf, comp, proj);
+			}
+		}
+
+		template<class EP, RandomAccessIterator I, class C, class P>
+		requires Sortable<I, C, P>
+		static I policy_sort(EP& policy, I first, I last, ext::scratch_buffer* scratch,
+			C& comp, P& proj)
+		{
+			// Moving elements into the scratch space in parallel leaves
+			// no good way to clean up after a move that throws.
+			if constexpr (detail::__parallel_policy<EP> &&
+				std::is_nothrow_move_constructible_v<iter_value_t<I>>)
+			{
+				auto& pool = policy.pool();
+				const auto n = last - first;
+				if (n >= 2 * parallel_threshold && pool.concurrency() > 1) {
+					detail::scratch_lease lease{!scratch};
+					if (!scratch) scratch = lease.get();
+					auto buf = detail::scratch_or_temporary_buffer<iter_value_t<I>>(scratch, n);
+					if (buf.size() >= n) {
+						parallel_merge_sort(pool, first, last, buf.data(), comp, proj);
+						return last;
+					}
+				}
+			}
+			random_access_sort(first, last, scratch, comp, proj);
+			return last;
+		}
+
+		// Sort runs of [first, last) concurrently, each using its share of
+		// the uninitialized space at buf as scratch; move them to buf; then
+		// merge pairs of runs back and forth between buf and [first, last).
+		template<RandomAccessIterator I, class C, class P>
+		requires Sortable<I, C, P>
+		static void parallel_merge_sort(ext::thread_pool& pool, I first, I last,
+			iter_value_t<I>* const buf, C& comp, P& proj)
+		{
+			using D = iter_difference_t<I>;
+			const D n = last - first;
+			const D threads = static_cast<D>(pool.concurrency());
+			const D runs = threads < n / parallel_threshold ? threads : n / parallel_threshold;
+			std::vector<D> bounds(static_cast<std::size_t>(runs + 1));
+			for (D i = 0; i <= runs; ++i) {
+				bounds[i] = n / runs * i + min(i, n % runs);
+			}
+			detail::parallel_for(pool, runs, D{1}, [&](D b, D e) {
+				for (; b < e; ++b) {
+					buf_t<I> part{buf + bounds[b], bounds[b + 1] - bounds[b]};
+					stable_sort_adaptive(first + bounds[b], first + bounds[b + 1],
+						part, comp, proj);
+				}
+			});
+
+			const D grain = D(detail::__parallel_grain);
+			detail::parallel_for(pool, n, grain, [&](D b, D e) {
+				for (; b < e; ++b) detail::construct(buf[b], iter_move(first + b));
+			});
+			struct destroyer {
+				iter_value_t<I>* buf;
+				D n;
+				~destroyer() { for_each(buf, buf + n, detail::destruct); }
+			} destroy{buf, n};
+
+			// Split each merge into pieces of about n / (4 * threads)
+			// elements.
+			const D piece = n / (4 * threads) > grain ? n / (4 * threads) : grain;
+			bool in_buffer = true;
+			for (D width = 1; width < runs; width *= 2) {
+				detail::task_group group{pool};
+				if (in_buffer) {
+					merge_round(group, buf, first, bounds, width, piece, comp, proj);
+				} else {
+					merge_round(group, first, buf, bounds, width, piece, comp, proj);
+				}
+				group.wait();
+				in_buffer = !in_buffer;
+			}
+			if (in_buffer) {
+				detail::parallel_for(pool, n, grain, [&](D b, D e) {
+					__stl2::move(buf + b, buf + e, first + b);
+				});
+			}
+		}
+
+		// The number of elements of [a, a + na) among the first d of the
+		// stable merge of [a, a + na) and [b, b + nb): where the merge path
+		// crosses diagonal d.
+		template<class I1, class I2, class D, class C, class P>
+		static D co_rank(I1 a, D na, I2 b, D nb, D d, C& comp, P& proj) {
+			D lo = d > nb ? d - nb : 0;
+			D hi = d < na ? d : na;
+			while (lo < hi) {
+				const D i = lo + (hi - lo) / 2;
+				// a[i] precedes b[d - i - 1] unless it's less.
+				if (!__stl2::invoke(comp, __stl2::invoke(proj, b[d - i - 1]),
+					__stl2::invoke(proj, a[i])))
+				{
+					lo = i + 1;
+				} else {
+					hi = i;
+				}
+			}
+			return lo;
+		}
+
+		// Merge the runs of src starting at bounds[i] for each multiple i
+		// of 2 * width with the runs that follow them, into dst, in
+		// pieces of about piece elements.
+		template<class Src, class Dst, class D, class C, class P>
+		static void merge_round(detail::task_group& group, Src src, Dst dst,
+			const std::vector<D>& bounds, D width, D piece, C& comp, P& proj)
+		{
+			const D runs = static_cast<D>(bounds.size()) - 1;
+			std::vector<D> splits;
+			for (D i = 0; i < runs; i += 2 * width) {
+				const D lo = bounds[i];
+				const D mid = bounds[min(i + width, runs)];
+				const D hi = bounds[min(i + 2 * width, runs)];
+				const D pieces = (hi - lo + piece - 1) / piece;
+				// Find every split before merging: merging moves from the
+				// elements that the searches compare.
+				splits.resize(static_cast<std::size_t>(pieces + 1));
+				for (D k = 0; k <= pieces; ++k) {
+					splits[k] = co_rank(src + lo, mid - lo, src + mid, hi - mid,
+						(hi - lo) * k / pieces, comp, proj);
+				}
+				for (D k = 0; k < pieces; ++k) {
+					const D d0 = (hi - lo) * k / pieces;
+					const D d1 = (hi - lo) * (k + 1) / pieces;
+					const D i0 = splits[k];
+					const D i1 = splits[k + 1];
+					group.run([=, &comp, &proj] {
+						merge(
+							__stl2::make_move_iterator(src + (lo + i0)),
+							__stl2::make_move_iterator(src + (lo + i1)),
+							__stl2::make_move_iterator(src + (mid + d0 - i0)),
+							__stl2::make_move_iterator(src + (mid + d1 - i1)),
+							dst + (lo + d0), __stl2::ref(comp),
+							__stl2::ref(proj), __stl2::ref(proj));
+					});
+				}
+			}
+		}
+
 		static constexpr int merge_sort_chunk_size = 7;
 
 		template<RandomAccessIterator I, class C, class P>
@@ -15,6 +15,8 @@
 
 #include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
 #include <stl2/detail/range/primitives.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -33,6 +35,14 @@ STL2_OPEN_NAMESPACE {
 		requires Writable<O, indirect_result_t<F&, projected<I, Proj>>>
 		constexpr unary_transform_result<I, O>
 		operator()(I first, S last, O result, F op, Proj proj = {}) const {
+			if constexpr (ext::SegmentedIterator<I> && Same<S, I>) {
+				ext::for_each_segment(first, last, [&](const auto& seg) {
+					result = (*this)(seg.begin(), seg.end(), std::move(result),
+						__stl2::ref(op), __stl2::ref(proj)).out;
+					return true;
+				});
+				return {std::move(last), std::move(result)};
+			}
 			for (; first != last; (void) ++first, (void) ++result) {
 				*result = __stl2::invoke(op, __stl2::invoke(proj, *first));
 			}
@@ -78,6 +88,85 @@ STL2_OPEN_NAMESPACE {
 			return (*this)(begin(r1), end(r1), begin(r2), end(r2), std::move(result),
 				__stl2::ref(op), __stl2::ref(proj1), __stl2::ref(proj2));
 		}
+
+		// Extension: execution policies
+		template<ext::ExecutionPolicy EP, RandomAccessIterator I, SizedSentinel<I> S,
+			RandomAccessIterator O, CopyConstructible F, class Proj = identity>
+		requires Writable<O, indirect_result_t<F&, projected<I, Proj>>>
+		unary_transform_result<I, O>
+		operator()(EP&& policy, I first, S last, O result, F op, Proj proj = {}) const {
+			const auto n = iter_difference_t<I>(last - first);
+			if constexpr (detail::__parallel_policy<EP>) {
+				detail::parallel_for(policy.pool(), n,
+					iter_difference_t<I>(detail::__parallel_grain),
+					[&](auto b, auto e) {
+						(*this)(first + b, first + e, result + iter_difference_t<O>(b),
+							__stl2::ref(op), __stl2::ref(proj));
+					});
+				return {first + n, result + iter_difference_t<O>(n)};
+			} else {
+				auto stop = first + n;
+				return (*this)(std::move(first), std::move(stop), std::move(result),
+					__stl2::ref(op), __stl2::ref(proj));
+			}
+		}
+
+		template<ext::ExecutionPolicy EP, detail::__parallel_range R,
+			RandomAccessIterator O, CopyConstructible F, class Proj = identity>
+		requires Writable<O, indirect_result_t<F&, projected<iterator_t<R>, Proj>>>
+		unary_transform_result<safe_iterator_t<R>, O>
+		operator()(EP&& policy, R&& r, O result, F op, Proj proj = {}) const {
+			return (*this)(std::forward<EP>(policy), begin(r), end(r), std::move(result),
+				__stl2::ref(op), __stl2::ref(proj));
+		}
+
+		template<ext::ExecutionPolicy EP,
+			RandomAccessIterator I1, SizedSentinel<I1> S1,
+			RandomAccessIterator I2, SizedSentinel<I2> S2,
+			RandomAccessIterator O, CopyConstructible F,
+			class Proj1 = identity, class Proj2 = identity>
+		requires Writable<O, indirect_result_t<F&,
+			projected<I1, Proj1>, projected<I2, Proj2>>>
+		binary_transform_result<I1, I2, O>
+		operator()(EP&& policy, I1 first1, S1 last1, I2 first2, S2 last2, O result,
+			F op, Proj1 proj1 = {}, Proj2 proj2 = {}) const
+		{
+			using D = iter_difference_t<I1>;
+			const auto n1 = D(last1 - first1);
+			const auto n2 = D(last2 - first2);
+			const D n = n1 < n2 ? n1 : n2;
+			if constexpr (detail::__parallel_policy<EP>) {
+				detail::parallel_for(policy.pool(), n, D(detail::__parallel_grain),
+					[&](D b, D e) {
+						(*this)(first1 + b, first1 + e,
+							first2 + iter_difference_t<I2>(b), first2 + iter_difference_t<I2>(e),
+							result + iter_difference_t<O>(b), __stl2::ref(op),
+							__stl2::ref(proj1), __stl2::ref(proj2));
+					});
+				return {first1 + n, first2 + iter_difference_t<I2>(n),
+					result + iter_difference_t<O>(n)};
+			} else {
+				auto stop1 = first1 + n;
+				auto stop2 = first2 + iter_difference_t<I2>(n);
+				return (*this)(std::move(first1), std::move(stop1), std::move(first2),
+					std::move(stop2), std::move(result), __stl2::ref(op),
+					__stl2::ref(proj1), __stl2::ref(proj2));
+			}
+		}
+
+		template<ext::ExecutionPolicy EP, detail::__parallel_range R1,
+			detail::__parallel_range R2, RandomAccessIterator O, CopyConstructible F,
+			class Proj1 = identity, class Proj2 = identity>
+		requires Writable<O, indirect_result_t<F&,
+			projected<iterator_t<R1>, Proj1>, projected<iterator_t<R2>, Proj2>>>
+		binary_transform_result<safe_iterator_t<R1>, safe_iterator_t<R2>, O>
+		operator()(EP&& policy, R1&& r1, R2&& r2, O result, F op,
+			Proj1 proj1 = {}, Proj2 proj2 = {}) const
+		{
+			return (*this)(std::forward<EP>(policy), begin(r1), end(r1),
+				begin(r2), end(r2), std::move(result), __stl2::ref(op),
+				__stl2::ref(proj1), __stl2::ref(proj2));
+		}
 	};
 
 	inline constexpr __transform_fn transform {};
@@ -0,0 +1,176 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_COMMON_TUPLE_HPP
+#define STL2_DETAIL_COMMON_TUPLE_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/concepts/core.hpp>
+#include <stl2/detail/concepts/object.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// common_tuple [Extension]
+//
+// A std::tuple - typically of references - that is also the proxy
+// reference type of iterators over several sequences at once, like
+// zip_view's. It converts from and to tuples of the referenced values,
+// and assigns through its elements even when const, as Writable requires.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<class... Ts>
+		class common_tuple : public std::tuple<Ts...> {
+			using base_t = std::tuple<Ts...>;
+
+			template<class T, std::size_t... Is>
+			constexpr common_tuple(T&& t, std::index_sequence<Is...>)
+			: base_t(std::get<Is>(static_cast<T&&>(t))...) {}
+
+			template<class Self, class T, std::size_t... Is>
+			static constexpr void assign(Self& self, T&& t, std::index_sequence<Is...>) {
+				((void)(std::get<Is>(self) = std::get<Is>(static_cast<T&&>(t))), ...);
+			}
+		public:
+			common_tuple() = default;
+
+			template<class... Us>
+			requires (sizeof...(Us) == sizeof...(Ts)) && (Constructible<Ts, Us> && ...)
+			constexpr common_tuple(Us&&... us)
+			: base_t(std::forward<Us>(us)...) {}
+
+			template<class... Us>
+			requires (sizeof...(Us) == sizeof...(Ts)) && (Constructible<Ts, Us&> && ...)
+			constexpr common_tuple(std::tuple<Us...>& that)
+			: common_tuple(that, std::index_sequence_for<Ts...>{}) {}
+			template<class... Us>
+			requires (sizeof...(Us) == sizeof...(Ts)) && (Constructible<Ts, const Us&> && ...)
+			constexpr common_tuple(const std::tuple<Us...>& that)
+			: common_tuple(that, std::index_sequence_for<Ts...>{}) {}
+			template<class... Us>
+			requires (sizeof...(Us) == sizeof...(Ts)) && (Constructible<Ts, Us> && ...)
+			constexpr common_tuple(std::tuple<Us...>&& that)
+			: common_tuple(std::move(that), std::index_sequence_for<Ts...>{}) {}
+
+			common_tuple(const common_tuple&) = default;
+			common_tuple(common_tuple&&) = default;
+			common_tuple& operator=(const common_tuple&) = default;
+			common_tuple& operator=(common_tuple&&) = default;
+
+			// Element-wise assignment, which for elements that are references
+			// assigns through them even when the common_tuple is const.
+			template<class... Us>
+			requires (sizeof...(Us) == sizeof...(Ts)) && (Assignable<Ts&, Us&> && ...)
+			constexpr common_tuple& operator=(std::tuple<Us...>& that) {
+				assign<base_t>(*this, that, std::index_sequence_for<Ts...>{});
+				return *this;
+			}
+			template<class... Us>
+			requires (sizeof...(Us) == sizeof...(Ts)) && (Assignable<Ts&, const Us&> && ...)
+			constexpr common_tuple& operator=(const std::tuple<Us...>& that) {
+				assign<base_t>(*this, that, std::index_sequence_for<Ts...>{});
+				return *this;
+			}
+			template<class... Us>
+			requires (sizeof...(Us) == sizeof...(Ts)) && (Assignable<Ts&, Us> && ...)
+			constexpr common_tuple& operator=(std::tuple<Us...>&& that) {
+				assign<base_t>(*this, std::move(that), std::index_sequence_for<Ts...>{});
+				return *this;
+			}
+
+			template<class... Us>
+			requires (sizeof...(Us) == sizeof...(Ts)) && (Assignable<const Ts&, Us&> && ...)
+			constexpr const common_tuple& operator=(std::tuple<Us...>& that) const {
+				assign<const base_t>(*this, that, std::index_sequence_for<Ts...>{});
+				return *this;
+			}
+			template<class... Us>
+			requires (sizeof...(Us) == sizeof...(Ts)) && (Assignable<const Ts&, const Us&> && ...)
+			constexpr const common_tuple& operator=(const std::tuple<Us...>& that) const {
+				assign<const base_t>(*this, that, std::index_sequence_for<Ts...>{});
+				return *this;
+			}
+			template<class... Us>
+			requires (sizeof...(Us) == sizeof...(Ts)) && (Assignable<const Ts&, Us> && ...)
+			constexpr const common_tuple& operator=(std::tuple<Us...>&& that) const {
+				assign<const base_t>(*this, std::move(that), std::index_sequence_for<Ts...>{});
+				return *this;
+			}
+		};
+
+		template<class... Ts>
+		common_tuple(Ts...) -> common_tuple<Ts...>;
+	}
+
+	template<class... Ts, class... Us, template<class> class TQual,
+		template<class> class UQual>
+	requires (sizeof...(Ts) == sizeof...(Us)) &&
+		(requires { typename common_reference_t<TQual<Ts>, UQual<Us>>; } && ...)
+	struct basic_common_reference<ext::common_tuple<Ts...>, ext::common_tuple<Us...>,
+		TQual, UQual> {
+		using type = ext::common_tuple<common_reference_t<TQual<Ts>, UQual<Us>>...>;
+	};
+
+	template<class... Ts, class... Us, template<class> class TQual,
+		template<class> class UQual>
+	requires (sizeof...(Ts) == sizeof...(Us)) &&
+		(requires { typename common_reference_t<TQual<Ts>, UQual<Us>>; } && ...)
+	struct basic_common_reference<ext::common_tuple<Ts...>, std::tuple<Us...>,
+		TQual, UQual> {
+		using type = ext::common_tuple<common_reference_t<TQual<Ts>, UQual<Us>>...>;
+	};
+
+	template<class... Ts, class... Us, template<class> class TQual,
+		template<class> class UQual>
+	requires (sizeof...(Ts) == sizeof...(Us)) &&
+		(requires { typename common_reference_t<TQual<Ts>, UQual<Us>>; } && ...)
+	struct basic_common_reference<std::tuple<Ts...>, ext::common_tuple<Us...>,
+		TQual, UQual> {
+		using type = ext::common_tuple<common_reference_t<TQual<Ts>, UQual<Us>>...>;
+	};
+
+	template<class... Ts, class... Us>
+	requires (sizeof...(Ts) == sizeof...(Us)) &&
+		(requires { typename common_type_t<Ts, Us>; } && ...)
+	struct common_type<ext::common_tuple<Ts...>, ext::common_tuple<Us...>> {
+		using type = std::tuple<common_type_t<Ts, Us>...>;
+	};
+
+	template<class... Ts, class... Us>
+	requires (sizeof...(Ts) == sizeof...(Us)) &&
+		(requires { typename common_type_t<Ts, Us>; } && ...)
+	struct common_type<ext::common_tuple<Ts...>, std::tuple<Us...>> {
+		using type = std::tuple<common_type_t<Ts, Us>...>;
+	};
+
+	template<class... Ts, class... Us>
+	requires (sizeof...(Ts) == sizeof...(Us)) &&
+		(requires { typename common_type_t<Ts, Us>; } && ...)
+	struct common_type<std::tuple<Ts...>, ext::common_tuple<Us...>> {
+		using type = std::tuple<common_type_t<Ts, Us>...>;
+	};
+} STL2_CLOSE_NAMESPACE
+
+namespace std {
+	template<class... Ts>
+	struct tuple_size<::__stl2::ext::common_tuple<Ts...>>
+	: tuple_size<tuple<Ts...>> {};
+
+	template<size_t I, class... Ts>
+	struct tuple_element<I, ::__stl2::ext::common_tuple<Ts...>>
+	: tuple_element<I, tuple<Ts...>> {};
+}
+
+#endif
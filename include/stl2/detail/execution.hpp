@@ -0,0 +1,399 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_EXECUTION_HPP
+#define STL2_DETAIL_EXECUTION_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/concepts/core.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Execution policies [Extension]
+//
+// The algorithms that accept an execution policy as their first argument
+// run under par or par_unseq by splitting random-access input into chunks
+// that the threads of a work-stealing thread_pool process concurrently.
+// Element access functions may be called concurrently, and must not race.
+// Unlike the std policies, an exception thrown by an element access
+// function propagates to the caller (the first, if several threads throw)
+// rather than calling std::terminate.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		///////////////////////////////////////////////////////////////////////////
+		// thread_pool
+		//
+		// Worker threads, each with a deque of tasks: a thread pushes and
+		// pops tasks at the back of its own deque, and when that's empty,
+		// steals from the front of another's. A thread that waits for tasks
+		// to finish runs queued tasks meanwhile, so tasks may wait on tasks.
+		//
+		class thread_pool {
+		public:
+			explicit thread_pool(unsigned workers)
+			: queues_(workers > 0 ? workers : 1)
+			{
+				threads_.reserve(workers);
+				for (unsigned i = 0; i < workers; ++i) {
+					threads_.emplace_back([this, i] { work(i); });
+				}
+			}
+
+			thread_pool(const thread_pool&) = delete;
+			thread_pool& operator=(const thread_pool&) = delete;
+
+			~thread_pool() {
+				{
+					std::lock_guard<std::mutex> lock{sleep_mutex_};
+					stop_ = true;
+				}
+				wake_.notify_all();
+				for (auto& t : threads_) t.join();
+			}
+
+			// The pool that par and par_unseq use unless told otherwise:
+			// together with the calling thread, one thread per core.
+			static thread_pool& default_pool() {
+				static thread_pool pool{
+					std::thread::hardware_concurrency() > 1
+						? std::thread::hardware_concurrency() - 1 : 0};
+				return pool;
+			}
+
+			// The number of threads that run tasks: the workers, and the
+			// thread waiting for them.
+			unsigned concurrency() const noexcept {
+				return static_cast<unsigned>(threads_.size()) + 1;
+			}
+
+			void push(std::function<void()> task) {
+				const auto i = self_ == this ? index_
+					: next_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+				{
+					std::lock_guard<std::mutex> lock{queues_[i].mutex};
+					queues_[i].tasks.push_back(std::move(task));
+				}
+				pending_.fetch_add(1, std::memory_order_release);
+				// Synchronize with a worker between checking pending_ and sleeping.
+				{ std::lock_guard<std::mutex> lock{sleep_mutex_}; }
+				wake_.notify_one();
+			}
+
+			// Runs one queued task, if there is one.
+			bool run_one() {
+				std::function<void()> task;
+				if (!pop(task)) return false;
+				task();
+				return true;
+			}
+		private:
+			struct alignas(64) queue {
+				std::mutex mutex;
+				std::deque<std::function<void()>> tasks;
+			};
+
+			std::vector<queue> queues_;
+			std::vector<std::thread> threads_;
+			std::atomic<std::size_t> pending_{0};
+			std::atomic<std::size_t> next_{0};
+			std::mutex sleep_mutex_;
+			std::condition_variable wake_;
+			bool stop_ = false;
+
+			static inline thread_local thread_pool* self_ = nullptr;
+			static inline thread_local std::size_t index_ = 0;
+
+			bool pop(std::function<void()>& task) {
+				if (pending_.load(std::memory_order_acquire) == 0) return false;
+				const bool worker = self_ == this;
+				const std::size_t home = worker ? index_ : 0;
+				for (std::size_t k = 0; k < queues_.size(); ++k) {
+					auto& q = queues_[(home + k) % queues_.size()];
+					std::lock_guard<std::mutex> lock{q.mutex};
+					if (q.tasks.empty()) continue;
+					if (worker && k == 0) {
+						task = std::move(q.tasks.back());
+						q.tasks.pop_back();
+					} else {
+						task = std::move(q.tasks.front());
+						q.tasks.pop_front();
+					}
+					pending_.fetch_sub(1, std::memory_order_relaxed);
+					return true;
+				}
+				return false;
+			}
+
+			void work(std::size_t i) {
+				self_ = this;
+				index_ = i;
+				while (true) {
+					if (run_one()) continue;
+					std::unique_lock<std::mutex> lock{sleep_mutex_};
+					wake_.wait(lock, [this] {
+						return stop_ || pending_.load(std::memory_order_acquire) != 0;
+					});
+					if (stop_) return;
+				}
+			}
+		};
+
+		///////////////////////////////////////////////////////////////////////////
+		// Execution policies
+		//
+		struct sequenced_policy {};
+
+		namespace __policy {
+			template<class Derived>
+			class on_pool {
+				thread_pool* pool_ = nullptr;
+			public:
+				// This policy, but running on pool instead of the default pool.
+				constexpr Derived on(thread_pool& pool) const noexcept {
+					Derived result;
+					result.pool_ = &pool;
+					return result;
+				}
+
+				thread_pool& pool() const {
+					return pool_ ? *pool_ : thread_pool::default_pool();
+				}
+			};
+		}
+
+		struct parallel_policy : __policy::on_pool<parallel_policy> {};
+		// Currently the same as parallel_policy: the chunks each thread
+		// processes run through the same vectorized kernels either way.
+		struct parallel_unsequenced_policy
+		: __policy::on_pool<parallel_unsequenced_policy> {};
+
+		inline constexpr sequenced_policy seq {};
+		inline constexpr parallel_policy par {};
+		inline constexpr parallel_unsequenced_policy par_unseq {};
+
+		template<class T>
+		inline constexpr bool is_execution_policy_v = false;
+		template<>
+		inline constexpr bool is_execution_policy_v<sequenced_policy> = true;
+		template<>
+		inline constexpr bool is_execution_policy_v<parallel_policy> = true;
+		template<>
+		inline constexpr bool is_execution_policy_v<parallel_unsequenced_policy> = true;
+
+		template<class T>
+		META_CONCEPT ExecutionPolicy = is_execution_policy_v<__uncvref<T>>;
+	}
+
+	namespace detail {
+		template<class EP>
+		META_CONCEPT __parallel_policy = ext::ExecutionPolicy<EP> &&
+			!Same<__uncvref<EP>, ext::sequenced_policy>;
+
+		template<class R>
+		META_CONCEPT __parallel_range = RandomAccessRange<R> &&
+			SizedSentinel<sentinel_t<R>, iterator_t<R>>;
+
+		// The fewest elements worth handing to another thread.
+		inline constexpr std::ptrdiff_t __parallel_grain = 2048;
+
+		///////////////////////////////////////////////////////////////////////////
+		// task_group
+		//
+		// Tasks run on a thread_pool, and waited for together.
+		//
+		class task_group {
+			ext::thread_pool& pool_;
+			std::atomic<std::ptrdiff_t> pending_{0};
+			std::atomic<bool> failed_{false};
+			std::exception_ptr error_;
+
+			void join() noexcept {
+				while (pending_.load(std::memory_order_acquire) != 0) {
+					if (!pool_.run_one()) std::this_thread::yield();
+				}
+			}
+		public:
+			explicit task_group(ext::thread_pool& pool) noexcept
+			: pool_(pool) {}
+
+			task_group(const task_group&) = delete;
+			task_group& operator=(const task_group&) = delete;
+
+			~task_group() { join(); }
+
+			ext::thread_pool& pool() const noexcept { return pool_; }
+
+			// Has a task thrown? Tasks not yet started won't be.
+			bool failed() const noexcept {
+				return failed_.load(std::memory_order_relaxed);
+			}
+
+			template<class F>
+			void run(F f) {
+				pending_.fetch_add(1, std::memory_order_relaxed);
+				try {
+					pool_.push([this, f = std::move(f)]() mutable {
+						if (!failed()) {
+							try {
+								f();
+							} catch (...) {
+								if (!failed_.exchange(true)) {
+									error_ = std::current_exception();
+								}
+							}
+						}
+						pending_.fetch_sub(1, std::memory_order_release);
+					});
+				} catch (...) {
+					pending_.fetch_sub(1, std::memory_order_relaxed);
+					throw;
+				}
+			}
+
+			// Run the pool's tasks until all of this group's have finished,
+			// and rethrow the first exception any of them threw.
+			void wait() {
+				join();
+				if (error_) std::rethrow_exception(std::exchange(error_, nullptr));
+			}
+		};
+
+		// A partition of [0, n) into no more chunks than keep the threads
+		// of pool busy, and none shorter than grain unless n is.
+		template<class D>
+		struct __chunks {
+			D count, size, extra;
+
+			__chunks(const ext::thread_pool& pool, const D n, const D grain) noexcept {
+				const D most = static_cast<D>(pool.concurrency()) * 4;
+				count = n / grain < most ? n / grain : most;
+				if (count < 1) count = 1;
+				size = n / count;
+				extra = n % count;
+			}
+
+			// The start of the i-th chunk, or n if i is count.
+			D bound(const D i) const noexcept {
+				return i * size + (i < extra ? i : extra);
+			}
+		};
+
+		// Call f(b, e) for each [b, e) of the partition of [0, n) that
+		// __chunks makes. The calling thread processes the first.
+		template<class D, class F>
+		void parallel_for(ext::thread_pool& pool, const D n, const D grain, F f) {
+			const __chunks<D> chunks{pool, n, grain};
+			if (chunks.count <= 1) {
+				f(D{0}, n);
+				return;
+			}
+			task_group group{pool};
+			for (D i = 1; i < chunks.count; ++i) {
+				group.run([&f, b = chunks.bound(i), e = chunks.bound(i + 1)] { f(b, e); });
+			}
+			f(D{0}, chunks.bound(1));
+			group.wait();
+		}
+
+		// The least i in [0, n) at which f(b, e) - which returns the
+		// position of the first match in [b, e), or e - finds a match; or
+		// n if there is none. Each chunk is searched grain elements at a
+		// time, and stops once a match has been found before it - or, if
+		// !First, anywhere.
+		template<bool First = true, class D, class F>
+		D parallel_find(ext::thread_pool& pool, const D n, const D grain, F f) {
+			std::atomic<D> found{n};
+			parallel_for(pool, n, grain, [&](D b, const D e) {
+				while (b < e) {
+					const D limit = found.load(std::memory_order_relaxed);
+					if (First ? limit < b : limit != n) return;
+					const D m = e - b > grain ? b + grain : e;
+					const D i = f(b, m);
+					if (i != m) {
+						D current = found.load(std::memory_order_relaxed);
+						while (i < current &&
+							!found.compare_exchange_weak(current, i, std::memory_order_relaxed))
+						{}
+						return;
+					}
+					b = m;
+				}
+			});
+			return found.load(std::memory_order_relaxed);
+		}
+
+		// init combined, by combine(init, r), with the result r = f(b, e)
+		// for each [b, e) of a partition of [0, n) as parallel_for splits it
+		// - in no particular order, so combine must be commutative as well
+		// as associative.
+		template<class D, class T, class F, class Combine>
+		T parallel_reduce(ext::thread_pool& pool, const D n, const D grain, T init,
+			F f, Combine combine)
+		{
+			if (n <= 0) return init;
+			std::mutex mutex;
+			parallel_for(pool, n, grain, [&](D b, D e) {
+				T partial = f(b, e);
+				std::lock_guard<std::mutex> lock{mutex};
+				init = combine(std::move(init), std::move(partial));
+			});
+			return init;
+		}
+
+		// Scan [0, n) in two passes over the partition that __chunks
+		// makes: first reduce(b, e) sums each chunk but the last; then
+		// scan(b, e, prefix) scans each chunk from prefix, the combination
+		// by combine(x, y) - which must be associative - of init with the
+		// sums of the chunks before it, in order. A pool of one thread
+		// scans in a single pass, which reads the input only once.
+		template<class D, class T, class Reduce, class Scan, class Combine>
+		void parallel_scan(ext::thread_pool& pool, const D n, const D grain, T init,
+			Reduce reduce, Scan scan, Combine combine)
+		{
+			const __chunks<D> chunks{pool, n, grain};
+			if (chunks.count <= 1 || pool.concurrency() == 1) {
+				scan(D{0}, n, std::move(init));
+				return;
+			}
+			std::vector<std::optional<T>> prefix(static_cast<std::size_t>(chunks.count));
+			parallel_for(pool, chunks.count - 1, D{1}, [&](D i, const D j) {
+				for (; i < j; ++i) {
+					prefix[i + 1].emplace(reduce(chunks.bound(i), chunks.bound(i + 1)));
+				}
+			});
+			prefix[0].emplace(std::move(init));
+			for (D i = 1; i < chunks.count; ++i) {
+				prefix[i].emplace(combine(T(*prefix[i - 1]), std::move(*prefix[i])));
+			}
+			parallel_for(pool, chunks.count, D{1}, [&](D i, const D j) {
+				for (; i < j; ++i) {
+					scan(chunks.bound(i), chunks.bound(i + 1), std::move(*prefix[i]));
+				}
+			});
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
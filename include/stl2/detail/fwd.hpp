@@ -23,6 +23,9 @@
  #define STL2_HAS_BUILTIN(X) STL2_HAS_BUILTIN_ ## X
  #if defined(__GNUC__)
   #define STL2_HAS_BUILTIN_unreachable 1
+  #if __GNUC__ >= 9
+   #define STL2_HAS_BUILTIN_is_constant_evaluated 1
+  #endif
  #endif // __GNUC__
 #endif // __clang__
 
@@ -191,6 +194,20 @@ STL2_OPEN_NAMESPACE {
 		inline constexpr priority_tag<4> max_priority_tag{};
 	}
 
+	namespace detail {
+		// Is the enclosing call being evaluated as part of a constant
+		// expression? Conservatively answers "yes" when the compiler offers
+		// no way to tell so that callers stay on their constexpr-friendly
+		// code paths.
+		constexpr bool is_constant_evaluated() noexcept {
+#if STL2_HAS_BUILTIN(is_constant_evaluated)
+			return __builtin_is_constant_evaluated();
+#else
+			return true;
+#endif
+		}
+	}
+
 	struct __niebloid {
 		explicit __niebloid() = default;
 		__niebloid(const __niebloid&) = delete;
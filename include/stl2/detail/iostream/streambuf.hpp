@@ -0,0 +1,156 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_IOSTREAM_STREAMBUF_HPP
+#define STL2_DETAIL_IOSTREAM_STREAMBUF_HPP
+
+#include <climits>
+#include <cstddef>
+#include <iosfwd>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/contiguous.hpp>
+#include <stl2/detail/iterator/default_sentinel.hpp>
+#include <stl2/detail/iterator/istreambuf_iterator.hpp>
+#include <stl2/detail/iterator/ostreambuf_iterator.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Stream buffer segments [Extension]
+//
+// Algorithms over istreambuf_iterator ranges process the buffered
+// characters of the stream buffer's get area a block at a time instead
+// of calling sgetc and sbumpc per character, and algorithms writing to
+// an ostreambuf_iterator hand whole blocks to sputn.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// The get area pointers of a basic_streambuf are protected, but a
+		// derived class may form pointers to those members, which then
+		// apply to any basic_streambuf.
+		template<class charT, class traits>
+		struct __streambuf_access : std::basic_streambuf<charT, traits> {
+			using streambuf_type = std::basic_streambuf<charT, traits>;
+
+			// The characters buffered in s's get area.
+			static std::pair<const charT*, const charT*>
+			get_area(streambuf_type& s) noexcept {
+				return {(s.*&__streambuf_access::gptr)(),
+					(s.*&__streambuf_access::egptr)()};
+			}
+
+			// Consume the first n characters of s's get area.
+			static void consume(streambuf_type& s, std::ptrdiff_t n) noexcept {
+				for (; n > INT_MAX; n -= INT_MAX) {
+					(s.*&__streambuf_access::gbump)(INT_MAX);
+				}
+				(s.*&__streambuf_access::gbump)(static_cast<int>(n));
+			}
+		};
+
+		template<class I>
+		META_CONCEPT __istreambuf_iter = requires {
+				typename I::char_type;
+				typename I::traits_type;
+			} &&
+			Same<I, istreambuf_iterator<typename I::char_type, typename I::traits_type>>;
+
+		template<class O>
+		META_CONCEPT __ostreambuf_iter = requires {
+				typename O::char_type;
+				typename O::traits_type;
+			} &&
+			Same<O, ostreambuf_iterator<typename O::char_type, typename O::traits_type>>;
+
+		// [first, last) denotes the characters of a stream buffer that
+		// remain when last is the end-of-stream iterator.
+		template<class I, class S>
+		META_CONCEPT __istreambuf_range = __istreambuf_iter<I> &&
+			(Same<S, I> || Same<S, default_sentinel>);
+
+		constexpr bool __end_of_stream(default_sentinel) noexcept {
+			return true;
+		}
+		template<__istreambuf_iter I>
+		bool __end_of_stream(const I& i) {
+			return i == default_sentinel{};
+		}
+
+		// Call f(first, last) with each run of characters [first, last)
+		// remaining in sbuf, refilling the get area between runs; f returns
+		// the position up to which it consumed the run, and a position
+		// before last stops the walk there. Returns whether f stopped.
+		template<class charT, class traits, class F>
+		bool __for_each_get_segment(std::basic_streambuf<charT, traits>* sbuf, F f) {
+			using access = __streambuf_access<charT, traits>;
+			while (sbuf) {
+				auto [first, last] = access::get_area(*sbuf);
+				if (first == last) {
+					const auto c = sbuf->sgetc();
+					if (traits::eq_int_type(c, traits::eof())) {
+						return false;
+					}
+					std::tie(first, last) = access::get_area(*sbuf);
+					if (first == last) {
+						// An unbuffered stream hands out a character at a time.
+						const charT ch = traits::to_char_type(c);
+						if (f(&ch, &ch + 1) != &ch + 1) {
+							return true;
+						}
+						sbuf->sbumpc();
+						continue;
+					}
+				}
+				const charT* const pos = f(first, last);
+				access::consume(*sbuf, pos - first);
+				if (pos != last) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		// O writes to a stream buffer of I's characters.
+		template<class O, class charT, class traits = std::char_traits<charT>>
+		META_CONCEPT __ostreambuf_of = __ostreambuf_iter<O> &&
+			Same<typename O::char_type, charT> &&
+			Same<typename O::traits_type, traits>;
+
+		// Write the n characters at s through result as if by n assignments.
+		template<__ostreambuf_iter O>
+		void __sputn(O& result, const typename O::char_type* s, std::ptrdiff_t n) {
+			if (auto sbuf = result.rdbuf(); sbuf && n > 0) {
+				if (sbuf->sputn(s, n) != n) {
+					result = O{};
+				}
+			}
+		}
+
+		// I denotes an array of O's characters.
+		template<class I, class O>
+		META_CONCEPT __sputn_copyable = __ostreambuf_iter<O> &&
+			__raw_iterator<I> && !__unwrap<I>::reversed &&
+			Same<iter_value_t<__unwrap_t<I>>, typename O::char_type>;
+
+		// Write the n characters starting at first through result with a
+		// single sputn, and advance first past them.
+		template<class I, class O>
+		requires __sputn_copyable<I, O>
+		void __sputn_forward(I& first, iter_difference_t<I> n, O& result) {
+			if (n <= 0) return;
+			__sputn(result, __lowest_address<false>(first, n), n);
+			__unwrap<I>::advance(first, n);
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -33,6 +33,7 @@ STL2_OPEN_NAMESPACE {
 	// Not to spec:
 	// * requirements are implicit.
 	//   See https://github.com/ericniebler/stl2/issues/246)
+	// * Extension: rdbuf()
 	//
 	template<class charT, class traits = std::char_traits<charT>>
 	requires
@@ -124,6 +125,12 @@ STL2_OPEN_NAMESPACE {
 				{}
 				using base_t::base_t;
 
+				// Extension: the stream buffer read by this iterator, or
+				// nullptr once it has been incremented to the end of stream.
+				streambuf_type* rdbuf() const noexcept {
+					return base_t::get().rdbuf();
+				}
+
 				// Yuck. This can't be simply "basic_iterator<cursor>".
 				// Since basic_iterator<cursor> derives from mixin, mixin must be
 				// instantiable before basic_iterator<cursor> is complete.
@@ -168,6 +175,10 @@ STL2_OPEN_NAMESPACE {
 				return at_end();
 			}
 
+			streambuf_type* rdbuf() const noexcept {
+				return sbuf_;
+			}
+
 		private:
 			detail::raw_ptr<streambuf_type> sbuf_ = nullptr;
 
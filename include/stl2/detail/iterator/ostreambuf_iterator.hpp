@@ -25,6 +25,7 @@
 STL2_OPEN_NAMESPACE {
 	// Not to spec:
 	// * Extension: satisfies EqualityComparable and Sentinel<default_sentinel>
+	// * Extension: rdbuf()
 	template<class charT, class traits = std::char_traits<charT>>
 	class ostreambuf_iterator {
 	public:
@@ -62,6 +63,11 @@ STL2_OPEN_NAMESPACE {
 		bool failed() const noexcept {
 			return sbuf_ != nullptr;
 		}
+		// Extension: the stream buffer written by this iterator, or
+		// nullptr once a write has failed.
+		streambuf_type* rdbuf() const noexcept {
+			return sbuf_;
+		}
 		friend bool operator==(ostreambuf_iterator a, ostreambuf_iterator b) noexcept {
 			return a.sbuf_ == b.sbuf_;
 		}
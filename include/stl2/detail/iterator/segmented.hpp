@@ -0,0 +1,68 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ITERATOR_SEGMENTED_HPP
+#define STL2_DETAIL_ITERATOR_SEGMENTED_HPP
+
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Segmented iterators [Extension]
+//
+// An iterator over elements that are stored in a sequence of segments -
+// like join_view's iterator over a vector of vectors - customizes
+// for_each_segment(first, last, f) to call f(seg) for each segment seg
+// holding elements of [first, last), in order, until f returns false.
+// seg.begin() and seg.end() are local iterators - the segment's own -
+// that denote those elements, and seg.compose(l) is the iterator that
+// denotes the element at local position l.
+//
+// Algorithms then run their inner loops - or their contiguous fast
+// paths - over each segment's local iterators, rather than checking
+// both levels on every increment.
+//
+STL2_OPEN_NAMESPACE {
+	namespace __for_each_segment {
+		// Not a poison pill, simply a non-ADL block.
+		void for_each_segment(); // undefined
+
+		struct probe {
+			template<class Segment>
+			bool operator()(Segment&&) const; // undefined
+		};
+
+		template<class I, class F>
+		META_CONCEPT has_customization =
+			requires(const I& i, F&& f) {
+				for_each_segment(i, i, static_cast<F&&>(f));
+			};
+
+		struct fn {
+			template<class I, class F>
+			requires has_customization<I, F>
+			constexpr void operator()(const I& first, const I& last, F&& f) const {
+				for_each_segment(first, last, static_cast<F&&>(f));
+			}
+		};
+	}
+
+	namespace ext {
+		inline constexpr __for_each_segment::fn for_each_segment {};
+
+		template<class I>
+		META_CONCEPT SegmentedIterator = ForwardIterator<I> &&
+			__for_each_segment::has_customization<I, __for_each_segment::probe>;
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
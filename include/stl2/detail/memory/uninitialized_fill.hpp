@@ -15,6 +15,7 @@
 
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/contiguous.hpp>
 #include <stl2/detail/memory/concepts.hpp>
 #include <stl2/detail/memory/construct_at.hpp>
 #include <stl2/detail/memory/destroy.hpp>
@@ -27,6 +28,12 @@ STL2_OPEN_NAMESPACE {
 		template<_NoThrowForwardIterator I, _NoThrowSentinel<I> S, class T>
 		requires Constructible<iter_value_t<I>, const T&>
 		I operator()(I first, S last, const T& x) const {
+			if constexpr (SizedSentinel<S, I> && detail::__fill_value<I, T> &&
+				std::is_trivially_constructible_v<iter_value_t<I>, const T&>)
+			{
+				detail::__memset_forward(first, last - first, x);
+				return first;
+			}
 			auto guard = detail::destroy_guard{first};
 			for (; first != last; ++first) {
 				__stl2::__construct_at(*first, x);
@@ -51,6 +58,12 @@ STL2_OPEN_NAMESPACE {
 		template<_NoThrowForwardIterator I, class T>
 		requires Constructible<iter_value_t<I>, const T&>
 		I operator()(I first, const iter_difference_t<I> n, const T& x) const {
+			if constexpr (detail::__fill_value<I, T> &&
+				std::is_trivially_constructible_v<iter_value_t<I>, const T&>)
+			{
+				detail::__memset_forward(first, n, x);
+				return first;
+			}
 			return uninitialized_fill(
 				counted_iterator{std::move(first), n},
 				default_sentinel{}, x).base();
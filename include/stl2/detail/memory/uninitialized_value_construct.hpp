@@ -15,6 +15,7 @@
 
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/contiguous.hpp>
 #include <stl2/detail/memory/concepts.hpp>
 #include <stl2/detail/memory/construct_at.hpp>
 #include <stl2/detail/memory/destroy.hpp>
@@ -27,6 +28,14 @@ STL2_OPEN_NAMESPACE {
 		template<_NoThrowForwardIterator I, _NoThrowSentinel<I> S>
 		requires DefaultConstructible<iter_value_t<I>>
 		I operator()(I first, S last) const {
+			if constexpr (SizedSentinel<S, I> && detail::__raw_iterator<I> &&
+				std::is_trivial_v<iter_value_t<I>>)
+			{
+				// Value-initializing a trivial type produces the same bytes
+				// every time; usually all zeros.
+				detail::__memset_forward(first, last - first, iter_value_t<I>());
+				return first;
+			}
 			auto guard = detail::destroy_guard{first};
 			for (; first != last; ++first) {
 				__stl2::__construct_at(*first);
@@ -51,6 +60,10 @@ STL2_OPEN_NAMESPACE {
 		template<_NoThrowForwardIterator I>
 		requires DefaultConstructible<iter_value_t<I>>
 		I operator()(I first, iter_difference_t<I> n) const {
+			if constexpr (detail::__raw_iterator<I> && std::is_trivial_v<iter_value_t<I>>) {
+				detail::__memset_forward(first, n, iter_value_t<I>());
+				return first;
+			}
 			return uninitialized_value_construct(
 				counted_iterator{first, n},
 				default_sentinel{}).base();
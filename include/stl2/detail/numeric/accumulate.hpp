@@ -0,0 +1,63 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_NUMERIC_ACCUMULATE_HPP
+#define STL2_DETAIL_NUMERIC_ACCUMULATE_HPP
+
+#include <functional>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/contiguous.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/numeric/concepts.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// accumulate [Extension]
+//
+// Folds the projected elements into init from left to right with op,
+// which defaults to +.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct __accumulate_fn : private __niebloid {
+			template<InputIterator I, Sentinel<I> S, class T,
+				class Op = std::plus<>, class Proj = identity>
+			requires detail::__fold_op<Op, T, iter_reference_t<projected<I, Proj>>>
+			constexpr T
+			operator()(I first, S last, T init, Op op = {}, Proj proj = {}) const {
+				if constexpr (SizedSentinel<S, I> && std::is_integral_v<T> &&
+					detail::MemReducible<I, T, Op, Proj>)
+				{
+					// Integer + and * are associative, so order is unobservable.
+					if (!detail::is_constant_evaluated()) {
+						return detail::__memreduce<Op>(first, last - first, init);
+					}
+				}
+				for (; first != last; ++first) {
+					init = __stl2::invoke(op, std::move(init), __stl2::invoke(proj, *first));
+				}
+				return init;
+			}
+
+			template<InputRange R, class T, class Op = std::plus<>, class Proj = identity>
+			requires detail::__fold_op<Op, T, iter_reference_t<projected<iterator_t<R>, Proj>>>
+			constexpr T
+			operator()(R&& r, T init, Op op = {}, Proj proj = {}) const {
+				return (*this)(begin(r), end(r), std::move(init), __stl2::ref(op),
+					__stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __accumulate_fn accumulate {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
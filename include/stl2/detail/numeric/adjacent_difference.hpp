@@ -0,0 +1,77 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_NUMERIC_ADJACENT_DIFFERENCE_HPP
+#define STL2_DETAIL_NUMERIC_ADJACENT_DIFFERENCE_HPP
+
+#include <functional>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/contiguous.hpp>
+#include <stl2/detail/algorithm/results.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/numeric/concepts.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/dangling.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// adjacent_difference [Extension]
+//
+// Writes to result the first projected element, and then op(y, x) for
+// each pair of adjacent projected elements x and y in turn; op defaults
+// to -, which arrays of arithmetic values subtract a vector at a time.
+// result may be first.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<class I, class O>
+		using adjacent_difference_result = __in_out_result<I, O>;
+
+		struct __adjacent_difference_fn : private __niebloid {
+			template<InputIterator I, Sentinel<I> S, WeaklyIncrementable O,
+				class Op = std::minus<>, class Proj = identity>
+			requires detail::__adjacent_difference_op<Op, I, Proj, O>
+			constexpr adjacent_difference_result<I, O>
+			operator()(I first, S last, O result, Op op = {}, Proj proj = {}) const {
+				if (first == last) return {std::move(first), std::move(result)};
+				using V = detail::__projected_value_t<I, Proj>;
+				V acc(__stl2::invoke(proj, *first));
+				*result = acc;
+				++first;
+				++result;
+				if constexpr (SizedSentinel<S, I> && detail::MemDifferenceable<I, O, Op, Proj>) {
+					if (!detail::is_constant_evaluated()) {
+						detail::__memdifference(first, last - first, result, acc);
+						return {std::move(first), std::move(result)};
+					}
+				}
+				for (; first != last; (void) ++first, (void) ++result) {
+					V x(__stl2::invoke(proj, *first));
+					*result = __stl2::invoke(op, x, std::move(acc));
+					acc = std::move(x);
+				}
+				return {std::move(first), std::move(result)};
+			}
+
+			template<InputRange R, WeaklyIncrementable O, class Op = std::minus<>,
+				class Proj = identity>
+			requires detail::__adjacent_difference_op<Op, iterator_t<R>, Proj, O>
+			constexpr adjacent_difference_result<safe_iterator_t<R>, O>
+			operator()(R&& r, O result, Op op = {}, Proj proj = {}) const {
+				return (*this)(begin(r), end(r), std::move(result), __stl2::ref(op),
+					__stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __adjacent_difference_fn adjacent_difference {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
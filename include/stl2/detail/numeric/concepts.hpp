@@ -0,0 +1,109 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_NUMERIC_CONCEPTS_HPP
+#define STL2_DETAIL_NUMERIC_CONCEPTS_HPP
+
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/concepts/function.hpp>
+#include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		///////////////////////////////////////////////////////////////////////////
+		// __fold_op [Implementation detail]
+		//
+		// A T accumulates values of type U, one at a time, as
+		// t = op(std::move(t), u).
+		//
+		template<class Op, class T, class U>
+		META_CONCEPT __fold_op =
+			MoveConstructible<T> &&
+			Invocable<Op&, T, U> &&
+			Assignable<T&, invoke_result_t<Op&, T, U>>;
+
+		///////////////////////////////////////////////////////////////////////////
+		// __reduce_op [Implementation detail]
+		//
+		// A T accumulates values of type U with op in any order and grouping:
+		// a U starts a partial result, and partial results accumulate into
+		// each other.
+		//
+		template<class Op, class T, class U>
+		META_CONCEPT __reduce_op =
+			__fold_op<Op, T, U> &&
+			__fold_op<Op, T, T> &&
+			Constructible<T, U>;
+
+		template<class I, class Proj>
+		using __projected_value_t = iter_value_t<projected<I, Proj>>;
+		template<class I, class Proj>
+		using __projected_reference_t = iter_reference_t<projected<I, Proj>>;
+
+		///////////////////////////////////////////////////////////////////////////
+		// __partial_sum_op [Implementation detail]
+		//
+		// The elements of I, projected through Proj, accumulate with op
+		// from left to right into a copy of the first, and each partial
+		// result can be written to O.
+		//
+		template<class Op, class I, class Proj, class O>
+		META_CONCEPT __partial_sum_op =
+			Constructible<__projected_value_t<I, Proj>, __projected_reference_t<I, Proj>> &&
+			__fold_op<Op, __projected_value_t<I, Proj>, __projected_reference_t<I, Proj>> &&
+			Writable<O, const __projected_value_t<I, Proj>&>;
+
+		///////////////////////////////////////////////////////////////////////////
+		// __inclusive_scan_op [Implementation detail]
+		//
+		// Likewise, in any grouping.
+		//
+		template<class Op, class I, class Proj, class O>
+		META_CONCEPT __inclusive_scan_op =
+			__reduce_op<Op, __projected_value_t<I, Proj>, __projected_reference_t<I, Proj>> &&
+			Writable<O, const __projected_value_t<I, Proj>&>;
+
+		///////////////////////////////////////////////////////////////////////////
+		// __exclusive_scan_op [Implementation detail]
+		//
+		// The elements of I, projected through Proj, accumulate with op into
+		// a T in any grouping; each partial result can be written to O before
+		// the element that follows it, read beforehand into a copy, is
+		// accumulated.
+		//
+		template<class Op, class T, class I, class Proj, class O>
+		META_CONCEPT __exclusive_scan_op =
+			Constructible<__projected_value_t<I, Proj>, __projected_reference_t<I, Proj>> &&
+			__reduce_op<Op, T, __projected_reference_t<I, Proj>> &&
+			__fold_op<Op, T, __projected_value_t<I, Proj>> &&
+			Writable<O, const T&>;
+
+		///////////////////////////////////////////////////////////////////////////
+		// __adjacent_difference_op [Implementation detail]
+		//
+		// op(x, std::move(y)) - where x and y are copies of adjacent elements
+		// of I projected through Proj, y the earlier - can be written to O,
+		// as can a copy of the first element.
+		//
+		template<class Op, class I, class Proj, class O>
+		META_CONCEPT __adjacent_difference_op =
+			Constructible<__projected_value_t<I, Proj>, __projected_reference_t<I, Proj>> &&
+			Movable<__projected_value_t<I, Proj>> &&
+			Invocable<Op&, __projected_value_t<I, Proj>&, __projected_value_t<I, Proj>> &&
+			Writable<O, const __projected_value_t<I, Proj>&> &&
+			Writable<O, invoke_result_t<Op&, __projected_value_t<I, Proj>&,
+				__projected_value_t<I, Proj>>>;
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
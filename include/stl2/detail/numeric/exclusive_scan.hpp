@@ -0,0 +1,124 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_NUMERIC_EXCLUSIVE_SCAN_HPP
+#define STL2_DETAIL_NUMERIC_EXCLUSIVE_SCAN_HPP
+
+#include <functional>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/contiguous.hpp>
+#include <stl2/detail/algorithm/results.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution.hpp>
+#include <stl2/detail/numeric/concepts.hpp>
+#include <stl2/detail/numeric/reduce.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/dangling.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// exclusive_scan [Extension]
+//
+// Writes to result the running folds of init and the projected elements
+// with op, which defaults to +, each exclusive of its own element: init,
+// then op of init and the first element, and so on. As with
+// inclusive_scan, op may be applied in any grouping. result may be first.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<class I, class O>
+		using exclusive_scan_result = __in_out_result<I, O>;
+
+		struct __exclusive_scan_fn : private __niebloid {
+			template<InputIterator I, Sentinel<I> S, WeaklyIncrementable O, class T,
+				class Op = std::plus<>, class Proj = identity>
+			requires detail::__exclusive_scan_op<Op, T, I, Proj, O>
+			constexpr exclusive_scan_result<I, O>
+			operator()(I first, S last, O result, T init, Op op = {},
+				Proj proj = {}) const
+			{
+				if constexpr (SizedSentinel<S, I> && detail::MemScannable<I, O, T, Op, Proj>) {
+					if (!detail::is_constant_evaluated()) {
+						detail::__memscan<true>(first, last - first, result, init);
+						return {std::move(first), std::move(result)};
+					}
+				}
+				for (; first != last; (void) ++first, (void) ++result) {
+					// Read the element before result, which may be first, is written.
+					detail::__projected_value_t<I, Proj> x(__stl2::invoke(proj, *first));
+					*result = init;
+					init = __stl2::invoke(op, std::move(init), std::move(x));
+				}
+				return {std::move(first), std::move(result)};
+			}
+
+			template<InputRange R, WeaklyIncrementable O, class T,
+				class Op = std::plus<>, class Proj = identity>
+			requires detail::__exclusive_scan_op<Op, T, iterator_t<R>, Proj, O>
+			constexpr exclusive_scan_result<safe_iterator_t<R>, O>
+			operator()(R&& r, O result, T init, Op op = {}, Proj proj = {}) const {
+				return (*this)(begin(r), end(r), std::move(result), std::move(init),
+					__stl2::ref(op), __stl2::ref(proj));
+			}
+
+			// Extension: execution policies
+			template<ExecutionPolicy EP, RandomAccessIterator I, SizedSentinel<I> S,
+				RandomAccessIterator O, class T, class Op = std::plus<>,
+				class Proj = identity>
+			requires detail::__exclusive_scan_op<Op, T, I, Proj, O> && CopyConstructible<T>
+			exclusive_scan_result<I, O>
+			operator()(EP&& policy, I first, S last, O result, T init, Op op = {},
+				Proj proj = {}) const
+			{
+				using D = iter_difference_t<I>;
+				using DO = iter_difference_t<O>;
+				const auto n = D(last - first);
+				if constexpr (detail::__parallel_policy<EP>) {
+					detail::parallel_scan(policy.pool(), n, D(detail::__parallel_grain),
+						std::move(init),
+						[&](D b, D e) {
+							return ext::reduce(first + (b + 1), first + e,
+								T(__stl2::invoke(proj, first[b])),
+								__stl2::ref(op), __stl2::ref(proj));
+						},
+						[&](D b, D e, T prefix) {
+							(*this)(first + b, first + e, result + DO(b), std::move(prefix),
+								__stl2::ref(op), __stl2::ref(proj));
+						},
+						[&](T&& x, T&& y) -> T {
+							return __stl2::invoke(op, std::move(x), std::move(y));
+						});
+					return {first + n, result + DO(n)};
+				} else {
+					auto stop = first + n;
+					return (*this)(std::move(first), std::move(stop), std::move(result),
+						std::move(init), __stl2::ref(op), __stl2::ref(proj));
+				}
+			}
+
+			template<ExecutionPolicy EP, detail::__parallel_range R,
+				RandomAccessIterator O, class T, class Op = std::plus<>,
+				class Proj = identity>
+			requires detail::__exclusive_scan_op<Op, T, iterator_t<R>, Proj, O> &&
+				CopyConstructible<T>
+			exclusive_scan_result<safe_iterator_t<R>, O>
+			operator()(EP&& policy, R&& r, O result, T init, Op op = {},
+				Proj proj = {}) const
+			{
+				return (*this)(std::forward<EP>(policy), begin(r), end(r),
+					std::move(result), std::move(init), __stl2::ref(op), __stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __exclusive_scan_fn exclusive_scan {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
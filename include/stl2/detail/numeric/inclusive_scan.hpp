@@ -0,0 +1,122 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_NUMERIC_INCLUSIVE_SCAN_HPP
+#define STL2_DETAIL_NUMERIC_INCLUSIVE_SCAN_HPP
+
+#include <functional>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/results.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution.hpp>
+#include <stl2/detail/numeric/concepts.hpp>
+#include <stl2/detail/numeric/partial_sum.hpp>
+#include <stl2/detail/numeric/reduce.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/dangling.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// inclusive_scan [Extension]
+//
+// Like partial_sum, but op may be applied in any grouping, so the results
+// are unspecified unless op is associative. In exchange, inclusive_scan
+// adds arrays of arithmetic values a vector at a time, and under an
+// execution policy scans in two passes across threads: one sums chunks of
+// the range, and the next scans each chunk from the sum of those before.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<class I, class O>
+		using inclusive_scan_result = __in_out_result<I, O>;
+
+		struct __inclusive_scan_fn : private __niebloid {
+			template<InputIterator I, Sentinel<I> S, WeaklyIncrementable O,
+				class Op = std::plus<>, class Proj = identity>
+			requires detail::__inclusive_scan_op<Op, I, Proj, O>
+			constexpr inclusive_scan_result<I, O>
+			operator()(I first, S last, O result, Op op = {}, Proj proj = {}) const {
+				if (first == last) return {std::move(first), std::move(result)};
+				detail::__projected_value_t<I, Proj> acc(__stl2::invoke(proj, *first));
+				*result = acc;
+				++first;
+				++result;
+				return detail::__running_fold<true>(std::move(first), std::move(last),
+					std::move(result), std::move(acc), op, proj);
+			}
+
+			template<InputRange R, WeaklyIncrementable O, class Op = std::plus<>,
+				class Proj = identity>
+			requires detail::__inclusive_scan_op<Op, iterator_t<R>, Proj, O>
+			constexpr inclusive_scan_result<safe_iterator_t<R>, O>
+			operator()(R&& r, O result, Op op = {}, Proj proj = {}) const {
+				return (*this)(begin(r), end(r), std::move(result), __stl2::ref(op),
+					__stl2::ref(proj));
+			}
+
+			// Extension: execution policies
+			template<ExecutionPolicy EP, RandomAccessIterator I, SizedSentinel<I> S,
+				RandomAccessIterator O, class Op = std::plus<>, class Proj = identity>
+			requires detail::__inclusive_scan_op<Op, I, Proj, O> &&
+				CopyConstructible<detail::__projected_value_t<I, Proj>>
+			inclusive_scan_result<I, O>
+			operator()(EP&& policy, I first, S last, O result, Op op = {},
+				Proj proj = {}) const
+			{
+				using D = iter_difference_t<I>;
+				using DO = iter_difference_t<O>;
+				using V = detail::__projected_value_t<I, Proj>;
+				const auto n = D(last - first);
+				if constexpr (detail::__parallel_policy<EP>) {
+					if (n > 0) {
+						// Scan the rest of the range from the first element.
+						V init(__stl2::invoke(proj, *first));
+						*result = init;
+						const I in = first + 1;
+						const O out = result + DO(1);
+						detail::parallel_scan(policy.pool(), D(n - 1),
+							D(detail::__parallel_grain), std::move(init),
+							[&](D b, D e) {
+								return ext::reduce(in + (b + 1), in + e,
+									V(__stl2::invoke(proj, in[b])),
+									__stl2::ref(op), __stl2::ref(proj));
+							},
+							[&](D b, D e, V prefix) {
+								detail::__running_fold<true>(in + b, in + e, out + DO(b),
+									std::move(prefix), op, proj);
+							},
+							[&](V&& x, V&& y) -> V {
+								return __stl2::invoke(op, std::move(x), std::move(y));
+							});
+					}
+					return {first + n, result + DO(n)};
+				} else {
+					auto stop = first + n;
+					return (*this)(std::move(first), std::move(stop), std::move(result),
+						__stl2::ref(op), __stl2::ref(proj));
+				}
+			}
+
+			template<ExecutionPolicy EP, detail::__parallel_range R,
+				RandomAccessIterator O, class Op = std::plus<>, class Proj = identity>
+			requires detail::__inclusive_scan_op<Op, iterator_t<R>, Proj, O> &&
+				CopyConstructible<detail::__projected_value_t<iterator_t<R>, Proj>>
+			inclusive_scan_result<safe_iterator_t<R>, O>
+			operator()(EP&& policy, R&& r, O result, Op op = {}, Proj proj = {}) const {
+				return (*this)(std::forward<EP>(policy), begin(r), end(r),
+					std::move(result), __stl2::ref(op), __stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __inclusive_scan_fn inclusive_scan {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,81 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_NUMERIC_INNER_PRODUCT_HPP
+#define STL2_DETAIL_NUMERIC_INNER_PRODUCT_HPP
+
+#include <functional>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/contiguous.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/numeric/concepts.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// inner_product [Extension]
+//
+// Folds op2 of each pair of corresponding projected elements of the two
+// ranges into init from left to right with op1, stopping at the end of
+// the shorter range. op1 and op2 default to + and *.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct __inner_product_fn : private __niebloid {
+			template<InputIterator I1, Sentinel<I1> S1, InputIterator I2, Sentinel<I2> S2,
+				class T, class Op1 = std::plus<>, class Op2 = std::multiplies<>,
+				class Proj1 = identity, class Proj2 = identity>
+			requires detail::__fold_op<Op1, T,
+				indirect_result_t<Op2&, projected<I1, Proj1>, projected<I2, Proj2>>>
+			constexpr T
+			operator()(I1 first1, S1 last1, I2 first2, S2 last2, T init,
+				Op1 op1 = {}, Op2 op2 = {}, Proj1 proj1 = {}, Proj2 proj2 = {}) const
+			{
+				if constexpr (SizedSentinel<S1, I1> && SizedSentinel<S2, I2> &&
+					std::is_integral_v<T> &&
+					detail::MemDottable<I1, I2, T, Op1, Op2, Proj1, Proj2>)
+				{
+					// Integer + and * are associative, so order is unobservable.
+					if (!detail::is_constant_evaluated()) {
+						const auto n1 = last1 - first1;
+						const auto n2 = static_cast<iter_difference_t<I1>>(last2 - first2);
+						return detail::__memdot(first1, first2, n1 < n2 ? n1 : n2, init);
+					}
+				}
+				for (; bool(first1 != last1) && bool(first2 != last2);
+					(void) ++first1, (void) ++first2)
+				{
+					init = __stl2::invoke(op1, std::move(init),
+						__stl2::invoke(op2, __stl2::invoke(proj1, *first1),
+							__stl2::invoke(proj2, *first2)));
+				}
+				return init;
+			}
+
+			template<InputRange R1, InputRange R2, class T,
+				class Op1 = std::plus<>, class Op2 = std::multiplies<>,
+				class Proj1 = identity, class Proj2 = identity>
+			requires detail::__fold_op<Op1, T, indirect_result_t<Op2&,
+				projected<iterator_t<R1>, Proj1>, projected<iterator_t<R2>, Proj2>>>
+			constexpr T
+			operator()(R1&& r1, R2&& r2, T init, Op1 op1 = {}, Op2 op2 = {},
+				Proj1 proj1 = {}, Proj2 proj2 = {}) const
+			{
+				return (*this)(begin(r1), end(r1), begin(r2), end(r2), std::move(init),
+					__stl2::ref(op1), __stl2::ref(op2), __stl2::ref(proj1),
+					__stl2::ref(proj2));
+			}
+		};
+
+		inline constexpr __inner_product_fn inner_product {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,91 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_NUMERIC_PARTIAL_SUM_HPP
+#define STL2_DETAIL_NUMERIC_PARTIAL_SUM_HPP
+
+#include <functional>
+#include <type_traits>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/contiguous.hpp>
+#include <stl2/detail/algorithm/results.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/numeric/concepts.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/dangling.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// partial_sum [Extension]
+//
+// Writes to result the running folds of the projected elements from left
+// to right with op, which defaults to +: the first element, then op of
+// that and the second, and so on. result may be first.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// Store to the elements starting at result the running folds of
+		// acc and the projected elements of [first, last) with op - each
+		// inclusive of its own element - and return the positions past
+		// both. If Reassociate, op may be applied in any grouping.
+		template<bool Reassociate, class I, class S, class O, class V, class Op, class Proj>
+		constexpr __in_out_result<I, O>
+		__running_fold(I first, S last, O result, V acc, Op& op, Proj& proj) {
+			if constexpr (SizedSentinel<S, I> && MemScannable<I, O, V, Op, Proj> &&
+				(Reassociate || std::is_integral_v<V>))
+			{
+				// Integer + is associative, so grouping is unobservable.
+				if (!is_constant_evaluated()) {
+					detail::__memscan<false>(first, last - first, result, acc);
+					return {std::move(first), std::move(result)};
+				}
+			}
+			for (; first != last; (void) ++first, (void) ++result) {
+				acc = __stl2::invoke(op, std::move(acc), __stl2::invoke(proj, *first));
+				*result = acc;
+			}
+			return {std::move(first), std::move(result)};
+		}
+	}
+
+	namespace ext {
+		template<class I, class O>
+		using partial_sum_result = __in_out_result<I, O>;
+
+		struct __partial_sum_fn : private __niebloid {
+			template<InputIterator I, Sentinel<I> S, WeaklyIncrementable O,
+				class Op = std::plus<>, class Proj = identity>
+			requires detail::__partial_sum_op<Op, I, Proj, O>
+			constexpr partial_sum_result<I, O>
+			operator()(I first, S last, O result, Op op = {}, Proj proj = {}) const {
+				if (first == last) return {std::move(first), std::move(result)};
+				detail::__projected_value_t<I, Proj> acc(__stl2::invoke(proj, *first));
+				*result = acc;
+				++first;
+				++result;
+				return detail::__running_fold<false>(std::move(first), std::move(last),
+					std::move(result), std::move(acc), op, proj);
+			}
+
+			template<InputRange R, WeaklyIncrementable O, class Op = std::plus<>,
+				class Proj = identity>
+			requires detail::__partial_sum_op<Op, iterator_t<R>, Proj, O>
+			constexpr partial_sum_result<safe_iterator_t<R>, O>
+			operator()(R&& r, O result, Op op = {}, Proj proj = {}) const {
+				return (*this)(begin(r), end(r), std::move(result), __stl2::ref(op),
+					__stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __partial_sum_fn partial_sum {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,109 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_NUMERIC_REDUCE_HPP
+#define STL2_DETAIL_NUMERIC_REDUCE_HPP
+
+#include <functional>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/contiguous.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
+#include <stl2/detail/numeric/concepts.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// reduce [Extension]
+//
+// Like accumulate, but op may combine init and the projected elements in
+// any order and grouping, so the result is unspecified unless op is
+// associative and commutative. In exchange, reduce adds or multiplies
+// arrays of arithmetic values several vectors at a time, and under an
+// execution policy splits the work across threads.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct __reduce_fn : private __niebloid {
+			template<InputIterator I, Sentinel<I> S, class T,
+				class Op = std::plus<>, class Proj = identity>
+			requires detail::__reduce_op<Op, T, iter_reference_t<projected<I, Proj>>>
+			constexpr T
+			operator()(I first, S last, T init, Op op = {}, Proj proj = {}) const {
+				if constexpr (SizedSentinel<S, I> && detail::MemReducible<I, T, Op, Proj>) {
+					if (!detail::is_constant_evaluated()) {
+						return detail::__memreduce<Op>(first, last - first, init);
+					}
+				} else if constexpr (ext::SegmentedIterator<I> && Same<S, I>) {
+					ext::for_each_segment(first, last, [&](const auto& seg) {
+						init = (*this)(seg.begin(), seg.end(), std::move(init),
+							__stl2::ref(op), __stl2::ref(proj));
+						return true;
+					});
+					return init;
+				}
+				for (; first != last; ++first) {
+					init = __stl2::invoke(op, std::move(init), __stl2::invoke(proj, *first));
+				}
+				return init;
+			}
+
+			template<InputRange R, class T, class Op = std::plus<>, class Proj = identity>
+			requires detail::__reduce_op<Op, T,
+				iter_reference_t<projected<iterator_t<R>, Proj>>>
+			constexpr T
+			operator()(R&& r, T init, Op op = {}, Proj proj = {}) const {
+				return (*this)(begin(r), end(r), std::move(init), __stl2::ref(op),
+					__stl2::ref(proj));
+			}
+
+			// Extension: execution policies
+			template<ExecutionPolicy EP, RandomAccessIterator I, SizedSentinel<I> S,
+				class T, class Op = std::plus<>, class Proj = identity>
+			requires detail::__reduce_op<Op, T, iter_reference_t<projected<I, Proj>>>
+			T operator()(EP&& policy, I first, S last, T init, Op op = {},
+				Proj proj = {}) const
+			{
+				using D = iter_difference_t<I>;
+				const auto n = D(last - first);
+				if constexpr (detail::__parallel_policy<EP>) {
+					return detail::parallel_reduce(policy.pool(), n,
+						D(detail::__parallel_grain), std::move(init),
+						[&](D b, D e) {
+							return (*this)(first + (b + 1), first + e,
+								T(__stl2::invoke(proj, first[b])),
+								__stl2::ref(op), __stl2::ref(proj));
+						},
+						[&](T&& x, T&& y) -> T {
+							return __stl2::invoke(op, std::move(x), std::move(y));
+						});
+				} else {
+					auto stop = first + n;
+					return (*this)(std::move(first), std::move(stop), std::move(init),
+						__stl2::ref(op), __stl2::ref(proj));
+				}
+			}
+
+			template<ExecutionPolicy EP, detail::__parallel_range R, class T,
+				class Op = std::plus<>, class Proj = identity>
+			requires detail::__reduce_op<Op, T,
+				iter_reference_t<projected<iterator_t<R>, Proj>>>
+			T operator()(EP&& policy, R&& r, T init, Op op = {}, Proj proj = {}) const {
+				return (*this)(std::forward<EP>(policy), begin(r), end(r),
+					std::move(init), __stl2::ref(op), __stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __reduce_fn reduce {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,198 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_NUMERIC_TRANSFORM_REDUCE_HPP
+#define STL2_DETAIL_NUMERIC_TRANSFORM_REDUCE_HPP
+
+#include <functional>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/contiguous.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution.hpp>
+#include <stl2/detail/numeric/concepts.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// transform_reduce [Extension]
+//
+// reduce applied to the results of a unary transformation of each
+// projected element, or of a binary transformation of each pair of
+// corresponding projected elements of two ranges - which stops at the end
+// of the shorter one, and defaults to summing products. As with reduce,
+// the order and grouping in which the results are combined is unspecified.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct __transform_reduce_fn : private __niebloid {
+			template<InputIterator I, Sentinel<I> S, class T, class ROp,
+				CopyConstructible TOp, class Proj = identity>
+			requires detail::__reduce_op<ROp, T,
+				indirect_result_t<TOp&, projected<I, Proj>>>
+			constexpr T
+			operator()(I first, S last, T init, ROp rop, TOp top, Proj proj = {}) const {
+				for (; first != last; ++first) {
+					init = __stl2::invoke(rop, std::move(init),
+						__stl2::invoke(top, __stl2::invoke(proj, *first)));
+				}
+				return init;
+			}
+
+			template<InputRange R, class T, class ROp, CopyConstructible TOp,
+				class Proj = identity>
+			requires detail::__reduce_op<ROp, T,
+				indirect_result_t<TOp&, projected<iterator_t<R>, Proj>>>
+			constexpr T
+			operator()(R&& r, T init, ROp rop, TOp top, Proj proj = {}) const {
+				return (*this)(begin(r), end(r), std::move(init), __stl2::ref(rop),
+					__stl2::ref(top), __stl2::ref(proj));
+			}
+
+			template<InputIterator I1, Sentinel<I1> S1, InputIterator I2, Sentinel<I2> S2,
+				class T, class ROp = std::plus<>, CopyConstructible TOp = std::multiplies<>,
+				class Proj1 = identity, class Proj2 = identity>
+			requires detail::__reduce_op<ROp, T,
+				indirect_result_t<TOp&, projected<I1, Proj1>, projected<I2, Proj2>>>
+			constexpr T
+			operator()(I1 first1, S1 last1, I2 first2, S2 last2, T init,
+				ROp rop = {}, TOp top = {}, Proj1 proj1 = {}, Proj2 proj2 = {}) const
+			{
+				if constexpr (SizedSentinel<S1, I1> && SizedSentinel<S2, I2> &&
+					detail::MemDottable<I1, I2, T, ROp, TOp, Proj1, Proj2>)
+				{
+					if (!detail::is_constant_evaluated()) {
+						const auto n1 = last1 - first1;
+						const auto n2 = static_cast<iter_difference_t<I1>>(last2 - first2);
+						return detail::__memdot(first1, first2, n1 < n2 ? n1 : n2, init);
+					}
+				}
+				for (; bool(first1 != last1) && bool(first2 != last2);
+					(void) ++first1, (void) ++first2)
+				{
+					init = __stl2::invoke(rop, std::move(init),
+						__stl2::invoke(top, __stl2::invoke(proj1, *first1),
+							__stl2::invoke(proj2, *first2)));
+				}
+				return init;
+			}
+
+			template<InputRange R1, InputRange R2, class T,
+				class ROp = std::plus<>, CopyConstructible TOp = std::multiplies<>,
+				class Proj1 = identity, class Proj2 = identity>
+			requires detail::__reduce_op<ROp, T, indirect_result_t<TOp&,
+				projected<iterator_t<R1>, Proj1>, projected<iterator_t<R2>, Proj2>>>
+			constexpr T
+			operator()(R1&& r1, R2&& r2, T init, ROp rop = {}, TOp top = {},
+				Proj1 proj1 = {}, Proj2 proj2 = {}) const
+			{
+				return (*this)(begin(r1), end(r1), begin(r2), end(r2), std::move(init),
+					__stl2::ref(rop), __stl2::ref(top), __stl2::ref(proj1),
+					__stl2::ref(proj2));
+			}
+
+			// Extension: execution policies
+			template<ExecutionPolicy EP, RandomAccessIterator I, SizedSentinel<I> S,
+				class T, class ROp, CopyConstructible TOp, class Proj = identity>
+			requires detail::__reduce_op<ROp, T,
+				indirect_result_t<TOp&, projected<I, Proj>>>
+			T operator()(EP&& policy, I first, S last, T init, ROp rop, TOp top,
+				Proj proj = {}) const
+			{
+				using D = iter_difference_t<I>;
+				const auto n = D(last - first);
+				if constexpr (detail::__parallel_policy<EP>) {
+					return detail::parallel_reduce(policy.pool(), n,
+						D(detail::__parallel_grain), std::move(init),
+						[&](D b, D e) {
+							return (*this)(first + (b + 1), first + e,
+								T(__stl2::invoke(top, __stl2::invoke(proj, first[b]))),
+								__stl2::ref(rop), __stl2::ref(top), __stl2::ref(proj));
+						},
+						[&](T&& x, T&& y) -> T {
+							return __stl2::invoke(rop, std::move(x), std::move(y));
+						});
+				} else {
+					auto stop = first + n;
+					return (*this)(std::move(first), std::move(stop), std::move(init),
+						__stl2::ref(rop), __stl2::ref(top), __stl2::ref(proj));
+				}
+			}
+
+			template<ExecutionPolicy EP, detail::__parallel_range R, class T,
+				class ROp, CopyConstructible TOp, class Proj = identity>
+			requires detail::__reduce_op<ROp, T,
+				indirect_result_t<TOp&, projected<iterator_t<R>, Proj>>>
+			T operator()(EP&& policy, R&& r, T init, ROp rop, TOp top,
+				Proj proj = {}) const
+			{
+				return (*this)(std::forward<EP>(policy), begin(r), end(r),
+					std::move(init), __stl2::ref(rop), __stl2::ref(top),
+					__stl2::ref(proj));
+			}
+
+			template<ExecutionPolicy EP,
+				RandomAccessIterator I1, SizedSentinel<I1> S1,
+				RandomAccessIterator I2, SizedSentinel<I2> S2,
+				class T, class ROp = std::plus<>, CopyConstructible TOp = std::multiplies<>,
+				class Proj1 = identity, class Proj2 = identity>
+			requires detail::__reduce_op<ROp, T,
+				indirect_result_t<TOp&, projected<I1, Proj1>, projected<I2, Proj2>>>
+			T operator()(EP&& policy, I1 first1, S1 last1, I2 first2, S2 last2, T init,
+				ROp rop = {}, TOp top = {}, Proj1 proj1 = {}, Proj2 proj2 = {}) const
+			{
+				using D = iter_difference_t<I1>;
+				const auto n1 = D(last1 - first1);
+				const auto n2 = D(last2 - first2);
+				const D n = n1 < n2 ? n1 : n2;
+				if constexpr (detail::__parallel_policy<EP>) {
+					return detail::parallel_reduce(policy.pool(), n,
+						D(detail::__parallel_grain), std::move(init),
+						[&](D b, D e) {
+							const auto b2 = iter_difference_t<I2>(b);
+							return (*this)(first1 + (b + 1), first1 + e,
+								first2 + (b2 + 1), first2 + iter_difference_t<I2>(e),
+								T(__stl2::invoke(top, __stl2::invoke(proj1, first1[b]),
+									__stl2::invoke(proj2, first2[b2]))),
+								__stl2::ref(rop), __stl2::ref(top),
+								__stl2::ref(proj1), __stl2::ref(proj2));
+						},
+						[&](T&& x, T&& y) -> T {
+							return __stl2::invoke(rop, std::move(x), std::move(y));
+						});
+				} else {
+					auto stop1 = first1 + n;
+					auto stop2 = first2 + iter_difference_t<I2>(n);
+					return (*this)(std::move(first1), std::move(stop1), std::move(first2),
+						std::move(stop2), std::move(init),
+						__stl2::ref(rop), __stl2::ref(top), __stl2::ref(proj1),
+						__stl2::ref(proj2));
+				}
+			}
+
+			template<ExecutionPolicy EP, detail::__parallel_range R1,
+				detail::__parallel_range R2, class T,
+				class ROp = std::plus<>, CopyConstructible TOp = std::multiplies<>,
+				class Proj1 = identity, class Proj2 = identity>
+			requires detail::__reduce_op<ROp, T, indirect_result_t<TOp&,
+				projected<iterator_t<R1>, Proj1>, projected<iterator_t<R2>, Proj2>>>
+			T operator()(EP&& policy, R1&& r1, R2&& r2, T init, ROp rop = {},
+				TOp top = {}, Proj1 proj1 = {}, Proj2 proj2 = {}) const
+			{
+				return (*this)(std::forward<EP>(policy), begin(r1), end(r1),
+					begin(r2), end(r2), std::move(init), __stl2::ref(rop),
+					__stl2::ref(top), __stl2::ref(proj1), __stl2::ref(proj2));
+			}
+		};
+
+		inline constexpr __transform_reduce_fn transform_reduce {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,129 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_RANGE_PARTITION_HPP
+#define STL2_DETAIL_RANGE_PARTITION_HPP
+
+#include <utility>
+#include <vector>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/iterator/unreachable.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/view/subrange.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Range partitioning [Extension]
+//
+// ext::partition_range(r, k) splits r into a std::vector of k views that
+// together denote the elements of r in order, and whose sizes differ as
+// little as r's structure allows. The pieces are independent of each
+// other - though not of the ranges r refers to - so separate threads can
+// traverse them concurrently.
+//
+// A random-access sized range splits into subranges of its iterators.
+// Other ranges customize partition_range(r, k), found by ADL; the lazy
+// views that do so split their underlying range and adapt each piece,
+// so a pipeline splits without being materialized.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// Start of the i-th of k pieces of n elements: the first n % k
+		// pieces get one element more than the others.
+		template<class D>
+		constexpr D __partition_bound(const D n, const D k, const D i) noexcept {
+			return i * (n / k) + (i < n % k ? i : n % k);
+		}
+
+		// The k pieces make(lo, hi) of [0, n).
+		template<class D, class F>
+		auto __partition_by_bounds(const D n, const D k, F make) {
+			std::vector<decltype(make(D{}, D{}))> result;
+			result.reserve(static_cast<std::size_t>(k));
+			for (D i = 0; i < k; ++i) {
+				result.push_back(make(__partition_bound(n, k, i),
+					__partition_bound(n, k, i + 1)));
+			}
+			return result;
+		}
+
+		// Walking forward from the beginning of an R never reaches its
+		// end. Views whose sentinel wraps unreachable say so by
+		// specialization.
+		template<Range R>
+		inline constexpr bool __unbounded_range = Same<sentinel_t<R>, unreachable>;
+
+		// The pieces of a partition, each adapted by make.
+		template<class Pieces, class F>
+		auto __adapt_partition(Pieces&& pieces, F make) {
+			std::vector<decltype(make(std::move(pieces.front())))> result;
+			result.reserve(pieces.size());
+			for (auto& p : pieces) {
+				result.push_back(make(std::move(p)));
+			}
+			return result;
+		}
+	}
+
+	namespace __partition_range {
+		// Not a poison pill, simply a non-ADL block.
+		void partition_range(); // undefined
+
+		template<class R>
+		META_CONCEPT has_customization = Range<R> &&
+			requires(R&& r, iter_difference_t<iterator_t<R>> k) {
+				partition_range(static_cast<R&&>(r), k);
+			};
+
+		template<class R>
+		META_CONCEPT can_subrange = RandomAccessRange<R> && SizedRange<R> &&
+			(std::is_lvalue_reference_v<R> || _ForwardingRange<R>);
+
+		struct fn {
+			template<class R>
+			requires has_customization<R> || can_subrange<R>
+			auto operator()(R&& r, iter_difference_t<iterator_t<R>> k) const {
+				STL2_EXPECT(k > 0);
+				if constexpr (has_customization<R>) {
+					return partition_range(static_cast<R&&>(r), k);
+				} else {
+					using D = iter_difference_t<iterator_t<R>>;
+					auto first = __stl2::begin(r);
+					return detail::__partition_by_bounds(
+						static_cast<D>(__stl2::size(r)), k, [&first](D lo, D hi) {
+							return subrange{first + lo, first + hi};
+						});
+				}
+			}
+		};
+	}
+
+	namespace ext {
+		inline namespace __cpos {
+			inline constexpr __partition_range::fn partition_range {};
+		}
+
+		template<class R>
+		META_CONCEPT PartitionableRange = Range<R> &&
+			requires(R&& r) {
+				__stl2::ext::partition_range(static_cast<R&&>(r), 1);
+			};
+
+		// The type of the pieces into which partition_range splits an R.
+		template<PartitionableRange R>
+		using partition_piece_t = typename decltype(__stl2::ext::partition_range(
+			std::declval<R>(), 1))::value_type;
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,813 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_SIMD_HPP
+#define STL2_DETAIL_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <stl2/detail/fwd.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// SIMD kernels [Implementation detail]
+//
+// Written with the GCC/Clang vector extensions, which the compiler lowers to
+// SSE2 - or AVX2, when the target enables it - on x86 and to whatever the
+// target offers elsewhere. Define STL2_SIMD_WIDTH to override the vector
+// width in bytes.
+//
+#ifndef STL2_SIMD_WIDTH
+ #if defined(__AVX2__)
+  #define STL2_SIMD_WIDTH 32
+ #else
+  #define STL2_SIMD_WIDTH 16
+ #endif
+#endif
+
+// Searching kernels need a fast "which lanes matched" reduction, which the
+// vector extensions lack, so they use SSE2 intrinsics directly and AVX2 ones
+// when the processor they run on supports it.
+#ifndef STL2_SIMD_X86
+ #if defined(__SSE2__) && (defined(__x86_64__) || defined(__i386__))
+  #define STL2_SIMD_X86 1
+ #else
+  #define STL2_SIMD_X86 0
+ #endif
+#endif
+
+#if STL2_SIMD_X86
+#include <immintrin.h>
+#endif
+
+STL2_OPEN_NAMESPACE {
+	namespace detail::simd {
+		inline constexpr std::size_t width = STL2_SIMD_WIDTH;
+
+		// __vector<T>::type is a vector of width / sizeof(T) lanes of T.
+		template<class T>
+		struct __vector {};
+
+#define STL2_SIMD_VECTOR(T) \
+		template<> \
+		struct __vector<T> { \
+			typedef T type __attribute__((vector_size(STL2_SIMD_WIDTH))); \
+		}
+
+		STL2_SIMD_VECTOR(std::int8_t);
+		STL2_SIMD_VECTOR(std::uint8_t);
+		STL2_SIMD_VECTOR(std::int16_t);
+		STL2_SIMD_VECTOR(std::uint16_t);
+		STL2_SIMD_VECTOR(std::int32_t);
+		STL2_SIMD_VECTOR(std::uint32_t);
+		STL2_SIMD_VECTOR(std::int64_t);
+		STL2_SIMD_VECTOR(std::uint64_t);
+		STL2_SIMD_VECTOR(float);
+		STL2_SIMD_VECTOR(double);
+
+#undef STL2_SIMD_VECTOR
+
+		template<class T>
+		using vector = typename __vector<T>::type;
+
+		template<class T>
+		inline constexpr std::size_t lanes = width / sizeof(T);
+
+		// The unsigned integer type with the given size, whose vectors
+		// carry bit patterns of objects of that size.
+		template<std::size_t> struct __bits {};
+		template<> struct __bits<1> { using type = std::uint8_t; };
+		template<> struct __bits<2> { using type = std::uint16_t; };
+		template<> struct __bits<4> { using type = std::uint32_t; };
+		template<> struct __bits<8> { using type = std::uint64_t; };
+
+		template<std::size_t N>
+		using bits_t = typename __bits<N>::type;
+
+		template<class T>
+		vector<T> load(const void* p) noexcept {
+			vector<T> v;
+			std::memcpy(&v, p, sizeof(v));
+			return v;
+		}
+
+		template<class T>
+		void store(void* p, const vector<T>& v) noexcept {
+			std::memcpy(p, &v, sizeof(v));
+		}
+
+		template<class T>
+		vector<T> broadcast(const T x) noexcept {
+			vector<T> v;
+			for (std::size_t i = 0; i < lanes<T>; ++i) {
+				v[i] = x;
+			}
+			return v;
+		}
+
+		// Store the bytes of value into each of the n objects at p.
+		template<class T>
+		requires requires { typename bits_t<sizeof(T)>; }
+		void fill(T* p, std::size_t n, const T& value) noexcept {
+			using B = bits_t<sizeof(T)>;
+			B x;
+			std::memcpy(&x, std::addressof(value), sizeof(x));
+			const auto v = simd::broadcast<B>(x);
+			auto out = reinterpret_cast<unsigned char*>(p);
+			std::size_t i = 0;
+			for (; n - i >= 4 * lanes<B>; i += 4 * lanes<B>) {
+				simd::store<B>(out + (i + 0 * lanes<B>) * sizeof(T), v);
+				simd::store<B>(out + (i + 1 * lanes<B>) * sizeof(T), v);
+				simd::store<B>(out + (i + 2 * lanes<B>) * sizeof(T), v);
+				simd::store<B>(out + (i + 3 * lanes<B>) * sizeof(T), v);
+			}
+			for (; n - i >= lanes<B>; i += lanes<B>) {
+				simd::store<B>(out + i * sizeof(T), v);
+			}
+			for (; i < n; ++i) {
+				std::memcpy(out + i * sizeof(T), &x, sizeof(T));
+			}
+		}
+
+		// Does the processor we're running on support AVX2?
+		inline bool has_avx2() noexcept {
+#if defined(__AVX2__)
+			return true;
+#elif STL2_SIMD_X86
+			static const bool result =
+				(__builtin_cpu_init(), __builtin_cpu_supports("avx2"));
+			return result;
+#else
+			return false;
+#endif
+		}
+
+#if STL2_SIMD_X86
+		// Each lane of the result is all ones if the same lanes of x and y
+		// are equal, and all zeros otherwise.
+		template<std::size_t Size>
+		__m128i __eq(__m128i x, __m128i y) noexcept {
+			if constexpr (Size == 1) {
+				return _mm_cmpeq_epi8(x, y);
+			} else if constexpr (Size == 2) {
+				return _mm_cmpeq_epi16(x, y);
+			} else if constexpr (Size == 4) {
+				return _mm_cmpeq_epi32(x, y);
+			} else {
+				static_assert(Size == 8);
+				// SSE2 has no 64-bit compare: both halves must match.
+				const __m128i m = _mm_cmpeq_epi32(x, y);
+				return _mm_and_si128(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+			}
+		}
+
+		template<std::size_t Size>
+		__attribute__((target("avx2")))
+		__m256i __eq(__m256i x, __m256i y) noexcept {
+			if constexpr (Size == 1) {
+				return _mm256_cmpeq_epi8(x, y);
+			} else if constexpr (Size == 2) {
+				return _mm256_cmpeq_epi16(x, y);
+			} else if constexpr (Size == 4) {
+				return _mm256_cmpeq_epi32(x, y);
+			} else {
+				static_assert(Size == 8);
+				return _mm256_cmpeq_epi64(x, y);
+			}
+		}
+
+		// Bits [i * Size, (i + 1) * Size) of the result are set iff lane i
+		// of x equals the same lane of y.
+		template<std::size_t Size>
+		unsigned __eq_mask(__m128i x, __m128i y) noexcept {
+			return static_cast<unsigned>(_mm_movemask_epi8(simd::__eq<Size>(x, y)));
+		}
+
+		template<std::size_t Size>
+		__attribute__((target("avx2")))
+		unsigned __eq_mask(__m256i x, __m256i y) noexcept {
+			return static_cast<unsigned>(_mm256_movemask_epi8(simd::__eq<Size>(x, y)));
+		}
+
+		template<class T>
+		__m128i __broadcast_sse2(const T value) noexcept {
+			bits_t<sizeof(T)> x;
+			std::memcpy(&x, &value, sizeof(T));
+			if constexpr (sizeof(T) == 1) {
+				return _mm_set1_epi8(static_cast<char>(x));
+			} else if constexpr (sizeof(T) == 2) {
+				return _mm_set1_epi16(static_cast<short>(x));
+			} else if constexpr (sizeof(T) == 4) {
+				return _mm_set1_epi32(static_cast<int>(x));
+			} else {
+				return _mm_set1_epi64x(static_cast<long long>(x));
+			}
+		}
+
+		template<class T>
+		__attribute__((target("avx2")))
+		__m256i __broadcast_avx2(const T value) noexcept {
+			bits_t<sizeof(T)> x;
+			std::memcpy(&x, &value, sizeof(T));
+			if constexpr (sizeof(T) == 1) {
+				return _mm256_set1_epi8(static_cast<char>(x));
+			} else if constexpr (sizeof(T) == 2) {
+				return _mm256_set1_epi16(static_cast<short>(x));
+			} else if constexpr (sizeof(T) == 4) {
+				return _mm256_set1_epi32(static_cast<int>(x));
+			} else {
+				return _mm256_set1_epi64x(static_cast<long long>(x));
+			}
+		}
+
+		template<class T>
+		const T* __find_sse2(const T* first, const T* const last, const T value) noexcept {
+			constexpr std::ptrdiff_t step = 16 / sizeof(T);
+			const __m128i v = simd::__broadcast_sse2(value);
+			for (; last - first >= step; first += step) {
+				const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+				if (const unsigned m = simd::__eq_mask<sizeof(T)>(x, v)) {
+					return first + __builtin_ctz(m) / sizeof(T);
+				}
+			}
+			for (; first != last && !(*first == value); ++first)
+				;
+			return first;
+		}
+
+		template<class T>
+		__attribute__((target("avx2")))
+		const T* __find_avx2(const T* first, const T* const last, const T value) noexcept {
+			constexpr std::ptrdiff_t step = 32 / sizeof(T);
+			const __m256i v = simd::__broadcast_avx2(value);
+			for (; last - first >= step; first += step) {
+				const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+				if (const unsigned m = simd::__eq_mask<sizeof(T)>(x, v)) {
+					return first + __builtin_ctz(m) / sizeof(T);
+				}
+			}
+			for (; first != last && !(*first == value); ++first)
+				;
+			return first;
+		}
+
+		// The count kernels subtract each compare result - whose matching
+		// lanes are -1 in every byte - from per-byte counters, and sum the
+		// counters before any of them can wrap.
+		template<class T>
+		std::size_t __count_sse2(const T* first, const T* const last, const T value) noexcept {
+			constexpr std::ptrdiff_t step = 16 / sizeof(T);
+			const __m128i v = simd::__broadcast_sse2(value);
+			std::size_t bytes = 0;
+			while (last - first >= step) {
+				__m128i counts = _mm_setzero_si128();
+				for (int i = 0; i < 255 && last - first >= step; ++i, first += step) {
+					const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+					counts = _mm_sub_epi8(counts, simd::__eq<sizeof(T)>(x, v));
+				}
+				const __m128i sums = _mm_sad_epu8(counts, _mm_setzero_si128());
+				bytes += static_cast<std::size_t>(_mm_cvtsi128_si32(sums)) +
+					static_cast<std::size_t>(_mm_extract_epi16(sums, 4));
+			}
+			std::size_t n = bytes / sizeof(T);
+			for (; first != last; ++first) {
+				n += *first == value;
+			}
+			return n;
+		}
+
+		template<class T>
+		__attribute__((target("avx2")))
+		std::size_t __count_avx2(const T* first, const T* const last, const T value) noexcept {
+			constexpr std::ptrdiff_t step = 32 / sizeof(T);
+			const __m256i v = simd::__broadcast_avx2(value);
+			std::size_t bytes = 0;
+			while (last - first >= step) {
+				__m256i counts = _mm256_setzero_si256();
+				for (int i = 0; i < 255 && last - first >= step; ++i, first += step) {
+					const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+					counts = _mm256_sub_epi8(counts, simd::__eq<sizeof(T)>(x, v));
+				}
+				const __m256i sums = _mm256_sad_epu8(counts, _mm256_setzero_si256());
+				bytes += static_cast<std::size_t>(_mm256_extract_epi16(sums, 0)) +
+					static_cast<std::size_t>(_mm256_extract_epi16(sums, 4)) +
+					static_cast<std::size_t>(_mm256_extract_epi16(sums, 8)) +
+					static_cast<std::size_t>(_mm256_extract_epi16(sums, 12));
+			}
+			std::size_t n = bytes / sizeof(T);
+			for (; first != last; ++first) {
+				n += *first == value;
+			}
+			return n;
+		}
+
+		template<class T>
+		std::size_t __mismatch_sse2(const T* const x, const T* const y, const std::size_t n) noexcept {
+			constexpr std::size_t step = 16 / sizeof(T);
+			std::size_t i = 0;
+			for (; n - i >= step; i += step) {
+				const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i));
+				const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + i));
+				const unsigned m = ~simd::__eq_mask<sizeof(T)>(a, b) & 0xffff;
+				if (m) {
+					return i + __builtin_ctz(m) / sizeof(T);
+				}
+			}
+			for (; i != n && x[i] == y[i]; ++i)
+				;
+			return i;
+		}
+
+		template<class T>
+		__attribute__((target("avx2")))
+		std::size_t __mismatch_avx2(const T* const x, const T* const y, const std::size_t n) noexcept {
+			constexpr std::size_t step = 32 / sizeof(T);
+			std::size_t i = 0;
+			for (; n - i >= step; i += step) {
+				const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+				const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + i));
+				const unsigned m = ~simd::__eq_mask<sizeof(T)>(a, b);
+				if (m) {
+					return i + __builtin_ctz(m) / sizeof(T);
+				}
+			}
+			for (; i != n && x[i] == y[i]; ++i)
+				;
+			return i;
+		}
+
+		// The search kernels test, a vector at a time, which positions hold
+		// both the first and the last byte of the needle, and compare the
+		// bytes in between only at those candidates.
+		template<class T>
+		std::size_t __search_sse2(const T* const h, const std::size_t n,
+			const T* const needle, const std::size_t m) noexcept
+		{
+			const __m128i first = simd::__broadcast_sse2(needle[0]);
+			const __m128i last = simd::__broadcast_sse2(needle[m - 1]);
+			std::size_t i = 0;
+			for (; n - i >= m - 1 + 16; i += 16) {
+				const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h + i));
+				const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h + i + m - 1));
+				for (unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+						_mm_and_si128(simd::__eq<1>(a, first), simd::__eq<1>(b, last))));
+					mask; mask &= mask - 1)
+				{
+					const std::size_t j = i + __builtin_ctz(mask);
+					if (std::memcmp(h + j + 1, needle + 1, m - 2) == 0) return j;
+				}
+			}
+			for (; n - i >= m; ++i) {
+				if (h[i] == needle[0] && std::memcmp(h + i + 1, needle + 1, m - 1) == 0) return i;
+			}
+			return n;
+		}
+
+		template<class T>
+		__attribute__((target("avx2")))
+		std::size_t __search_avx2(const T* const h, const std::size_t n,
+			const T* const needle, const std::size_t m) noexcept
+		{
+			const __m256i first = simd::__broadcast_avx2(needle[0]);
+			const __m256i last = simd::__broadcast_avx2(needle[m - 1]);
+			std::size_t i = 0;
+			for (; n - i >= m - 1 + 32; i += 32) {
+				const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(h + i));
+				const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(h + i + m - 1));
+				for (unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(
+						_mm256_and_si256(simd::__eq<1>(a, first), simd::__eq<1>(b, last))));
+					mask; mask &= mask - 1)
+				{
+					const std::size_t j = i + __builtin_ctz(mask);
+					if (std::memcmp(h + j + 1, needle + 1, m - 2) == 0) return j;
+				}
+			}
+			for (; n - i >= m; ++i) {
+				if (h[i] == needle[0] && std::memcmp(h + i + 1, needle + 1, m - 1) == 0) return i;
+			}
+			return n;
+		}
+#endif // STL2_SIMD_X86
+
+		template<class T>
+		META_CONCEPT __searchable = std::is_integral_v<T> &&
+			(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+		// The first element of [first, last) that is equal to value, or last.
+		template<__searchable T>
+		const T* find(const T* first, const T* const last, const T value) noexcept {
+			if constexpr (sizeof(T) == 1) {
+				unsigned char byte;
+				std::memcpy(&byte, &value, 1);
+				const auto p = std::memchr(first, byte, static_cast<std::size_t>(last - first));
+				return p ? static_cast<const T*>(p) : last;
+			} else {
+#if STL2_SIMD_X86
+				if (simd::has_avx2()) {
+					return simd::__find_avx2(first, last, value);
+				}
+				return simd::__find_sse2(first, last, value);
+#else
+				for (; first != last && !(*first == value); ++first)
+					;
+				return first;
+#endif
+			}
+		}
+
+		// The number of elements of [first, last) that are equal to value.
+		template<__searchable T>
+		std::size_t count(const T* first, const T* const last, const T value) noexcept {
+#if STL2_SIMD_X86
+			if (simd::has_avx2()) {
+				return simd::__count_avx2(first, last, value);
+			}
+			return simd::__count_sse2(first, last, value);
+#else
+			std::size_t n = 0;
+			for (; first != last; ++first) {
+				n += *first == value;
+			}
+			return n;
+#endif
+		}
+
+		// The index of the first position at which the n-element arrays x
+		// and y differ, or n if they are equal.
+		template<__searchable T>
+		std::size_t mismatch(const T* const x, const T* const y, const std::size_t n) noexcept {
+#if STL2_SIMD_X86
+			if (simd::has_avx2()) {
+				return simd::__mismatch_avx2(x, y, n);
+			}
+			return simd::__mismatch_sse2(x, y, n);
+#else
+			std::size_t i = 0;
+			for (; i != n && x[i] == y[i]; ++i)
+				;
+			return i;
+#endif
+		}
+
+		// The index of the first occurrence of the m-element needle in the
+		// n-element haystack h, or n if there is none.
+		template<__searchable T>
+		requires (sizeof(T) == 1)
+		std::size_t search(const T* const h, const std::size_t n,
+			const T* const needle, const std::size_t m) noexcept
+		{
+			if (m == 0) return 0;
+			if (m > n) return n;
+			if (m == 1) {
+				return static_cast<std::size_t>(simd::find(h, h + n, needle[0]) - h);
+			}
+#if STL2_SIMD_X86
+			if (simd::has_avx2()) {
+				return simd::__search_avx2(h, n, needle, m);
+			}
+			return simd::__search_sse2(h, n, needle, m);
+#else
+			for (std::size_t i = 0; n - i >= m; ++i) {
+				if (h[i] == needle[0] && std::memcmp(h + i + 1, needle + 1, m - 1) == 0) return i;
+			}
+			return n;
+#endif
+		}
+
+		// Element types whose extremes the extremum kernels find.
+		template<class T>
+		META_CONCEPT __orderable =
+			(std::is_integral_v<T> && sizeof(T) == 4) ||
+			std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+		// What the extremum kernels return for elements that include a NaN,
+		// which < does not order.
+		inline constexpr std::size_t unordered = static_cast<std::size_t>(-1);
+
+		// Looks for the smallest - or if Greatest, the largest - element,
+		// and of equal elements for the first - or if Last, the last. Each
+		// lane of two vectors of candidates holds the extremum of the
+		// elements in that lane, and where it is, until merge folds them
+		// into index.
+		template<class T, bool Greatest, bool Last>
+		struct __extremum {
+			using V = vector<T>;
+			using IV = vector<bits_t<sizeof(T)>>;
+
+			std::size_t index = 0;
+			V value[2];
+			IV where[2];
+
+			// Does x, seen after y, take y's place?
+			static bool replaces(const T x, const T y) noexcept {
+				if constexpr (Greatest) {
+					return Last ? !(x < y) : y < x;
+				} else {
+					return Last ? !(y < x) : x < y;
+				}
+			}
+			static auto replaces(const V& x, const V& y) noexcept {
+				if constexpr (Greatest) {
+					if constexpr (Last) return x >= y; else return x > y;
+				} else {
+					if constexpr (Last) return x <= y; else return x < y;
+				}
+			}
+
+			void start(const V& x, const V& y, const IV& i, const IV& j) noexcept {
+				value[0] = x;
+				value[1] = y;
+				where[0] = i;
+				where[1] = j;
+			}
+
+			void update(const V& x, const V& y, const IV& i, const IV& j) noexcept {
+				const auto m = replaces(x, value[0]);
+				const auto n = replaces(y, value[1]);
+				value[0] = m ? x : value[0];
+				where[0] = m ? i : where[0];
+				value[1] = n ? y : value[1];
+				where[1] = n ? j : where[1];
+			}
+
+			// Fold the candidates, whose positions are relative to base,
+			// into index; equal elements are ordered by position.
+			void merge(const T* const p, const std::size_t base) noexcept {
+				for (const int k : {0, 1}) {
+					for (std::size_t l = 0; l < lanes<T>; ++l) {
+						const T x = value[k][l];
+						const std::size_t i = base + static_cast<std::size_t>(where[k][l]);
+						const T y = p[index];
+						if (x == y ? (Last ? i > index : i < index) : replaces(x, y)) {
+							index = i;
+						}
+					}
+				}
+			}
+
+			void step(const T* const p, const std::size_t i) noexcept {
+				if (replaces(p[i], p[index])) index = i;
+			}
+		};
+
+		// Run each of the __extremum e over the n > 0 elements at p, two
+		// vectors at a time. Returns false if an element is NaN.
+		template<class T, class... E>
+		bool __extrema(const T* const p, const std::size_t n, E&... e) noexcept {
+			using V = vector<T>;
+			using B = bits_t<sizeof(T)>;
+			using IV = vector<B>;
+			constexpr std::size_t step = 2 * lanes<T>;
+			// Positions in the lanes are relative to the start of a block
+			// that is short enough for B to hold them.
+			constexpr std::size_t block =
+				(std::numeric_limits<B>::max() < std::numeric_limits<std::size_t>::max()
+					? static_cast<std::size_t>(std::numeric_limits<B>::max())
+					: std::numeric_limits<std::size_t>::max()) / step * step;
+			IV first;
+			for (std::size_t l = 0; l < lanes<T>; ++l) {
+				first[l] = static_cast<B>(l);
+			}
+			const IV half = simd::broadcast<B>(static_cast<B>(lanes<T>));
+			const IV stride = simd::broadcast<B>(static_cast<B>(step));
+			[[maybe_unused]] decltype(V{} != V{}) nan{};
+
+			std::size_t i = 0;
+			while (n - i >= step) {
+				const std::size_t m = (n - i < block ? n - i : block) / step * step;
+				const T* const q = p + i;
+				IV at = first;
+				V x = simd::load<T>(q);
+				V y = simd::load<T>(q + lanes<T>);
+				if constexpr (std::is_floating_point_v<T>) {
+					nan |= (x != x) | (y != y);
+				}
+				(e.start(x, y, at, at + half), ...);
+				for (std::size_t j = step; j != m; j += step) {
+					at += stride;
+					x = simd::load<T>(q + j);
+					y = simd::load<T>(q + j + lanes<T>);
+					if constexpr (std::is_floating_point_v<T>) {
+						nan |= (x != x) | (y != y);
+					}
+					(e.update(x, y, at, at + half), ...);
+				}
+				(e.merge(p, i), ...);
+				i += m;
+			}
+			for (; i != n; ++i) {
+				if constexpr (std::is_floating_point_v<T>) {
+					if (p[i] != p[i]) return false;
+				}
+				(e.step(p, i), ...);
+			}
+			if constexpr (std::is_floating_point_v<T>) {
+				for (std::size_t l = 0; l < lanes<T>; ++l) {
+					if (nan[l]) return false;
+				}
+			}
+			return true;
+		}
+
+		// The index of the first smallest - or if Greatest, largest - of
+		// the n > 0 elements at p, or of the last one if Last, or unordered.
+		template<bool Greatest, bool Last, __orderable T>
+		std::size_t extremum(const T* const p, const std::size_t n) noexcept {
+			__extremum<T, Greatest, Last> e;
+			return simd::__extrema(p, n, e) ? e.index : unordered;
+		}
+
+		// The indices of the first smallest and the last largest - or if
+		// Greater, of the first largest and the last smallest - of the
+		// n > 0 elements at p, or unordered.
+		template<bool Greater, __orderable T>
+		std::pair<std::size_t, std::size_t>
+		minmax(const T* const p, const std::size_t n) noexcept {
+			__extremum<T, Greater, false> lo;
+			__extremum<T, !Greater, true> hi;
+			if (!simd::__extrema(p, n, lo, hi)) return {unordered, unordered};
+			return {lo.index, hi.index};
+		}
+
+		// Element types that the arithmetic kernels combine.
+		template<class T>
+		META_CONCEPT __arithmetic =
+			(std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8)) ||
+			std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+		template<bool Multiply, class V>
+		V __combine(const V& x, const V& y) noexcept {
+			if constexpr (Multiply) {
+				return x * y;
+			} else {
+				return x + y;
+			}
+		}
+
+		// Combine the n > 0 values at(i) with +, or with * if Multiply, in
+		// an unspecified order: vector_at(i) yields the lanes<T> values
+		// starting at(i), four vectors of which are combined per step.
+		template<bool Multiply, class T, class F, class G>
+		T __fold(const std::size_t n, F vector_at, G at) noexcept {
+			constexpr std::size_t step = lanes<T>;
+			std::size_t i = 1;
+			T result = at(0);
+			if (n >= 4 * step) {
+				vector<T> a = vector_at(0);
+				vector<T> b = vector_at(step);
+				vector<T> c = vector_at(2 * step);
+				vector<T> d = vector_at(3 * step);
+				for (i = 4 * step; n - i >= 4 * step; i += 4 * step) {
+					a = simd::__combine<Multiply>(a, vector_at(i));
+					b = simd::__combine<Multiply>(b, vector_at(i + step));
+					c = simd::__combine<Multiply>(c, vector_at(i + 2 * step));
+					d = simd::__combine<Multiply>(d, vector_at(i + 3 * step));
+				}
+				for (; n - i >= step; i += step) {
+					a = simd::__combine<Multiply>(a, vector_at(i));
+				}
+				a = simd::__combine<Multiply>(simd::__combine<Multiply>(a, b),
+					simd::__combine<Multiply>(c, d));
+				result = a[0];
+				for (std::size_t l = 1; l < step; ++l) {
+					result = simd::__combine<Multiply>(result, a[l]);
+				}
+			}
+			for (; i != n; ++i) {
+				result = simd::__combine<Multiply>(result, at(i));
+			}
+			return result;
+		}
+
+		// The lane type in which the kernels combine values of type T:
+		// integers wrap, so they are combined as unsigned integers of the
+		// same size, whose vectors exist whatever the spelling of T.
+		template<class T>
+		using __lane_t = std::conditional_t<std::is_integral_v<T>, bits_t<sizeof(T)>, T>;
+
+		// The sum - or if Multiply, the product - of the n > 0 elements at
+		// p, associated in an unspecified way.
+		template<bool Multiply, __arithmetic T>
+		T reduce(const T* const p, const std::size_t n) noexcept {
+			using L = __lane_t<T>;
+			return static_cast<T>(simd::__fold<Multiply, L>(n,
+				[p](std::size_t i) { return simd::load<L>(p + i); },
+				[p](std::size_t i) { return static_cast<L>(p[i]); }));
+		}
+
+		// The sum of the products of the n > 0 pairs of elements at x and
+		// y, associated in an unspecified way.
+		template<__arithmetic T>
+		T dot(const T* const x, const T* const y, const std::size_t n) noexcept {
+			using L = __lane_t<T>;
+			return static_cast<T>(simd::__fold<false, L>(n,
+				[x, y](std::size_t i) { return simd::load<L>(x + i) * simd::load<L>(y + i); },
+				[x, y](std::size_t i) { return static_cast<L>(x[i]) * static_cast<L>(y[i]); }));
+		}
+
+		// v with its lanes moved up by K, and the K lanes vacated at the
+		// bottom filled from the K highest lanes of fill.
+		template<std::size_t K, class T, std::size_t... I>
+		vector<T> __shift_up(const vector<T>& v, const vector<T>& fill,
+			std::index_sequence<I...>) noexcept
+		{
+#if defined(__clang__)
+			return __builtin_shufflevector(fill, v, (I + lanes<T> - K)...);
+#else
+			using mask = vector<bits_t<sizeof(T)>>;
+			return __builtin_shuffle(fill, v, mask{(I + lanes<T> - K)...});
+#endif
+		}
+
+		template<std::size_t K, class T>
+		vector<T> __shift_up(const vector<T>& v, const vector<T>& fill) noexcept {
+			return simd::__shift_up<K, T>(v, fill, std::make_index_sequence<lanes<T>>{});
+		}
+
+		// The running sums of the lanes of v, in log2(lanes) shifted adds.
+		template<class T, std::size_t K = 1>
+		vector<T> __prefix_sums(const vector<T>& v) noexcept {
+			if constexpr (K < lanes<T>) {
+				return simd::__prefix_sums<T, 2 * K>(v + simd::__shift_up<K, T>(v, vector<T>{}));
+			} else {
+				return v;
+			}
+		}
+
+		// Store to out the running sums, from carry, of the n elements at p
+		// - each inclusive of its own element or, if Exclusive, of those
+		// before it - associated in an unspecified way, and return carry
+		// plus all of them. out may be p.
+		template<bool Exclusive, __arithmetic T>
+		T scan(const T* const p, T* const out, const std::size_t n, const T carry) noexcept {
+			using L = __lane_t<T>;
+			constexpr std::size_t step = lanes<L>;
+			L c = static_cast<L>(carry);
+			std::size_t i = 0;
+			if (n >= step) {
+				vector<L> vc = simd::broadcast(c);
+				for (; n - i >= step; i += step) {
+					const vector<L> s = simd::__prefix_sums<L>(simd::load<L>(p + i));
+					if constexpr (Exclusive) {
+						simd::store<L>(out + i, simd::__shift_up<1, L>(s, vector<L>{}) + vc);
+					} else {
+						simd::store<L>(out + i, s + vc);
+					}
+					vc += s[step - 1];
+				}
+				c = vc[0];
+			}
+			for (; i != n; ++i) {
+				const L x = static_cast<L>(p[i]);
+				if constexpr (Exclusive) {
+					out[i] = static_cast<T>(c);
+					c += x;
+				} else {
+					c += x;
+					out[i] = static_cast<T>(c);
+				}
+			}
+			return static_cast<T>(c);
+		}
+
+		// Store to out[i] the difference p[i] - p[i - 1] of each of the n
+		// elements at p, where p[-1] is prev. out may be p.
+		template<__arithmetic T>
+		void differences(const T* const p, T* const out, const std::size_t n,
+			const T prev) noexcept
+		{
+			using L = __lane_t<T>;
+			constexpr std::size_t step = lanes<L>;
+			L q = static_cast<L>(prev);
+			std::size_t i = 0;
+			if (n >= step) {
+				vector<L> before = simd::broadcast(q);
+				for (; n - i >= step; i += step) {
+					const vector<L> v = simd::load<L>(p + i);
+					simd::store<L>(out + i, v - simd::__shift_up<1, L>(v, before));
+					before = v;
+				}
+				q = before[step - 1];
+			}
+			for (; i != n; ++i) {
+				const L x = static_cast<L>(p[i]);
+				out[i] = static_cast<T>(x - q);
+				q = x;
+			}
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
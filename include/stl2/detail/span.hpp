@@ -20,6 +20,7 @@
 #include <stl2/detail/algorithm/lexicographical_compare.hpp>
 #include <stl2/detail/concepts/core.hpp>
 #include <stl2/detail/iterator/reverse_iterator.hpp>
+#include <stl2/detail/range/partition.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // Implementation of P0122 span
@@ -247,6 +248,12 @@ STL2_OPEN_NAMESPACE {
 				return {data_ + offset, count};
 			}
 
+			// Extension: split into dynamic-extent spans.
+			friend auto partition_range(span s, index_type k) {
+				return detail::__partition_by_bounds(s.size(), k,
+					[&s](index_type lo, index_type hi) { return s.subspan(lo, hi - lo); });
+			}
+
 			// [span.obs], span observers
 			using __span::extent<Extent>::size;
 			constexpr index_type size_bytes() const noexcept
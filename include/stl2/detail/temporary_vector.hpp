@@ -12,7 +12,17 @@
 #ifndef STL2_DETAIL_TEMPORARY_VECTOR_HPP
 #define STL2_DETAIL_TEMPORARY_VECTOR_HPP
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <new>
+#include <utility>
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#else
+#include <experimental/memory_resource>
+#endif
 #include <stl2/type_traits.hpp>
 #include <stl2/utility.hpp>
 #include <stl2/detail/construct_destruct.hpp>
@@ -21,72 +31,241 @@
 #include <stl2/detail/concepts/object.hpp>
 
 STL2_OPEN_NAMESPACE {
+	namespace ext {
+		///////////////////////////////////////////////////////////////////////////
+		// Temporary memory resources [Extension]
+		//
+		// The scratch space of algorithms like stable_sort, stable_partition,
+		// and inplace_merge comes from the memory_resource set for the
+		// calling thread by a temporary_resource_scope, or else the one set
+		// for all threads by set_temporary_resource, or else operator new.
+		// Temporary buffers never outlive the algorithm call that allocates
+		// them, so a short-lived arena will do; the resource for all
+		// threads must tolerate concurrent use, though.
+		//
+#if __has_include(<memory_resource>)
+		using memory_resource = std::pmr::memory_resource;
+#else
+		using memory_resource = std::experimental::pmr::memory_resource;
+#endif
+
+		namespace __temporary_resource {
+			inline std::atomic<memory_resource*> global{nullptr};
+			inline thread_local memory_resource* local = nullptr;
+		}
+
+		inline memory_resource* get_temporary_resource() noexcept {
+			if (auto r = __temporary_resource::local) return r;
+			return __temporary_resource::global.load(std::memory_order_acquire);
+		}
+
+		// Use r for all threads without a temporary_resource_scope (or
+		// operator new, if r is nullptr). Returns the previous resource.
+		inline memory_resource* set_temporary_resource(memory_resource* r) noexcept {
+			return __temporary_resource::global.exchange(r, std::memory_order_acq_rel);
+		}
+
+		// Use r for the calling thread until the end of the scope.
+		class temporary_resource_scope {
+			memory_resource* previous_;
+		public:
+			explicit temporary_resource_scope(memory_resource* r) noexcept
+			: previous_{std::exchange(__temporary_resource::local, r)} {}
+
+			temporary_resource_scope(const temporary_resource_scope&) = delete;
+			temporary_resource_scope& operator=(const temporary_resource_scope&) = delete;
+
+			~temporary_resource_scope() {
+				__temporary_resource::local = previous_;
+			}
+		};
+	}
+
 	namespace detail {
-		struct temporary_buffer_deleter {
-			template<class T>
-			void operator()(T* ptr) const {
-				std::return_temporary_buffer(ptr);
+		// Memory from resource, or operator new if that's nullptr; or
+		// nullptr if there is none to be had.
+		inline void* allocate_temporary(ext::memory_resource* resource,
+			std::size_t bytes, std::size_t align) noexcept
+		{
+			if (align < alignof(std::max_align_t)) align = alignof(std::max_align_t);
+			if (!resource) return ::operator new(bytes, std::align_val_t{align}, std::nothrow);
+			try {
+				return resource->allocate(bytes, align);
+			} catch (std::bad_alloc&) {
+				return nullptr;
+			}
+		}
+
+		inline void deallocate_temporary(ext::memory_resource* resource, void* p,
+			std::size_t bytes, std::size_t align) noexcept
+		{
+			if (align < alignof(std::max_align_t)) align = alignof(std::max_align_t);
+			if (!resource) {
+				::operator delete(p, std::align_val_t{align});
+			} else {
+				resource->deallocate(p, bytes, align);
+			}
+		}
+
+		struct temporary_deleter {
+			ext::memory_resource* resource = nullptr;
+			std::size_t bytes = 0;
+			std::size_t align = 0;
+
+			void operator()(void* p) const noexcept {
+				deallocate_temporary(resource, p, bytes, align);
 			}
 		};
 
+		// Uninitialized space for up to n objects of type T - as many as the
+		// temporary resource can provide - or none.
 		template<class T>
 		class temporary_buffer {
-			std::unique_ptr<T, temporary_buffer_deleter> alloc_;
+			std::unique_ptr<void, temporary_deleter> alloc_;
+			T* data_ = nullptr;
 			std::ptrdiff_t size_ = 0;
 
-			temporary_buffer(std::pair<T*, std::ptrdiff_t> buf) :
-				alloc_{buf.first}, size_{buf.second} {}
-
 		public:
 			temporary_buffer() = default;
-			temporary_buffer(std::ptrdiff_t n)
-			: temporary_buffer(std::get_temporary_buffer<T>(n)) {}
+			temporary_buffer(std::ptrdiff_t n) {
+				auto const resource = ext::get_temporary_resource();
+				n = n < PTRDIFF_MAX / std::ptrdiff_t(sizeof(T))
+					? n : PTRDIFF_MAX / std::ptrdiff_t(sizeof(T));
+				// Like std::get_temporary_buffer, settle for less.
+				for (; n > 0; n /= 2) {
+					const auto bytes = static_cast<std::size_t>(n) * sizeof(T);
+					if (void* p = allocate_temporary(resource, bytes, alignof(T))) {
+						alloc_ = {p, temporary_deleter{resource, bytes, alignof(T)}};
+						data_ = static_cast<T*>(p);
+						size_ = n;
+						break;
+					}
+				}
+			}
+			// Space for n objects that someone else owns.
+			temporary_buffer(T* data, std::ptrdiff_t n) noexcept
+			: data_{data}, size_{data ? n : 0} {}
 
 			T* data() const {
-				return alloc_.get();
+				return data_;
 			}
 
 			std::ptrdiff_t size() const {
 				return size_;
 			}
 		};
+	}
 
-		template<class T>
-		requires alignof(T) > alignof(std::max_align_t)
-		class temporary_buffer<T> {
-			std::unique_ptr<unsigned char, temporary_buffer_deleter> alloc_;
-			T* aligned_ = nullptr;
-			std::ptrdiff_t size_ = 0;
+	namespace ext {
+		///////////////////////////////////////////////////////////////////////////
+		// scratch_buffer [Extension]
+		//
+		// Memory for the scratch space of algorithms like stable_sort, that
+		// outlives the calls that use it: repeated calls reuse a single
+		// allocation, growing it as needed. Not for concurrent use.
+		//
+		class scratch_buffer {
+			std::unique_ptr<void, detail::temporary_deleter> data_;
+			std::size_t size_ = 0;
+			memory_resource* resource_ = nullptr;
+		public:
+			scratch_buffer() = default;
+			// Scratch space from resource, or operator new if that's nullptr.
+			explicit scratch_buffer(memory_resource* resource) noexcept
+			: resource_{resource} {}
+			explicit scratch_buffer(std::size_t bytes, memory_resource* resource = nullptr)
+			: resource_{resource}
+			{
+				reserve(bytes);
+			}
+
+			std::size_t capacity() const noexcept {
+				return size_;
+			}
 
-			static_assert((alignof(T) & (alignof(T) - 1)) == 0,
-				"Alignment must be a power of two.");
+			memory_resource* resource() const noexcept {
+				return resource_;
+			}
 
-			temporary_buffer(std::pair<unsigned char*, std::ptrdiff_t> buf)
-			: alloc_{buf.first}
+			// Make room for bytes bytes aligned to align, discarding the
+			// current contents. Returns false if memory is exhausted.
+			bool reserve(std::size_t bytes,
+				std::size_t align = alignof(std::max_align_t)) noexcept
 			{
-				if (buf.second > 0 && static_cast<std::size_t>(buf.second) >= sizeof(T)) {
-					void* ptr = buf.first;
-					std::size_t n = buf.second;
-					aligned_ = static_cast<T*>(std::align(alignof(T), sizeof(T), ptr, n));
-					if (aligned_) {
-						size_ = n / sizeof(T);
-					}
+				if (bytes <= size_ && align <= data_.get_deleter().align) return true;
+				release();
+				void* p = detail::allocate_temporary(resource_, bytes, align);
+				if (!p) return false;
+				data_ = {p, detail::temporary_deleter{resource_, bytes, align}};
+				size_ = bytes;
+				return true;
+			}
+
+			void release() noexcept {
+				data_.reset();
+				size_ = 0;
+			}
+
+			// Uninitialized space for n objects of type T, or nullptr.
+			template<class T>
+			T* data(std::ptrdiff_t n) noexcept {
+				if (n < 0 || static_cast<std::size_t>(n) > PTRDIFF_MAX / sizeof(T)) {
+					return nullptr;
 				}
+				if (!reserve(n * sizeof(T), alignof(T))) return nullptr;
+				return static_cast<T*>(data_.get());
+			}
+		};
+	}
+
+	namespace detail {
+		// Space for n objects of type T from scratch, or if that's not to be
+		// had, a temporary_buffer of its own.
+		template<class T>
+		temporary_buffer<T> scratch_or_temporary_buffer(ext::scratch_buffer* scratch,
+			std::ptrdiff_t n)
+		{
+			if (scratch) {
+				if (T* p = scratch->data<T>(n)) return {p, n};
 			}
+			return temporary_buffer<T>{n};
+		}
+
+		// The calling thread's own scratch_buffer, unless a lease further up
+		// the stack already holds it, or there is a temporary resource to
+		// allocate from instead. It keeps up to retain bytes of memory
+		// between leases.
+		class scratch_lease {
+			ext::scratch_buffer* scratch_ = nullptr;
 
+			static inline thread_local bool leased_ = false;
+
+			static ext::scratch_buffer& local() noexcept {
+				static thread_local ext::scratch_buffer scratch;
+				return scratch;
+			}
 		public:
-			temporary_buffer() = default;
-			temporary_buffer(std::ptrdiff_t n)
-			: temporary_buffer(std::get_temporary_buffer<unsigned char>(
-				n * sizeof(T) + alignof(T) - 1))
-			{}
+			static constexpr std::size_t retain = std::size_t{1} << 22;
 
-			T* data() const {
-				return aligned_;
+			explicit scratch_lease(bool wanted = true) noexcept {
+				if (wanted && !leased_ && !ext::get_temporary_resource()) {
+					leased_ = true;
+					scratch_ = &local();
+				}
 			}
 
-			std::ptrdiff_t size() const {
-				return size_;
+			scratch_lease(const scratch_lease&) = delete;
+			scratch_lease& operator=(const scratch_lease&) = delete;
+
+			~scratch_lease() {
+				if (scratch_) {
+					if (scratch_->capacity() > retain) scratch_->release();
+					leased_ = false;
+				}
+			}
+
+			ext::scratch_buffer* get() const noexcept {
+				return scratch_;
 			}
 		};
 
@@ -110,7 +289,7 @@ STL2_OPEN_NAMESPACE {
 			temporary_vector() = default;
 			temporary_vector(temporary_buffer<T>& buf)
 			: begin_{buf.data()}, end_{begin_}
-			, alloc_{begin_ + buf.size_}
+			, alloc_{begin_ + buf.size()}
 			{}
 			temporary_vector(temporary_vector&&) = delete;
 			temporary_vector& operator=(temporary_vector&& that) = delete;
@@ -0,0 +1,25 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_NUMERIC_HPP
+#define STL2_NUMERIC_HPP
+
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/numeric/accumulate.hpp>
+#include <stl2/detail/numeric/adjacent_difference.hpp>
+#include <stl2/detail/numeric/exclusive_scan.hpp>
+#include <stl2/detail/numeric/inclusive_scan.hpp>
+#include <stl2/detail/numeric/inner_product.hpp>
+#include <stl2/detail/numeric/partial_sum.hpp>
+#include <stl2/detail/numeric/reduce.hpp>
+#include <stl2/detail/numeric/transform_reduce.hpp>
+
+#endif
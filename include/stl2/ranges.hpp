@@ -18,8 +18,11 @@
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
 #include <stl2/detail/range/nth_iterator.hpp>
+#include <stl2/detail/range/partition.hpp>
 #include <stl2/detail/range/primitives.hpp>
 #include <stl2/view/all.hpp>
+#include <stl2/view/cache_latest.hpp>
+#include <stl2/view/chunk.hpp>
 #include <stl2/view/common.hpp>
 #include <stl2/view/counted.hpp>
 #include <stl2/view/drop.hpp>
@@ -31,18 +34,22 @@
 #include <stl2/view/iota.hpp>
 #include <stl2/view/istream.hpp>
 #include <stl2/view/join.hpp>
+#include <stl2/view/mapped_file.hpp>
 #include <stl2/view/move.hpp>
 #include <stl2/view/ref.hpp>
 #include <stl2/view/repeat_n.hpp>
 #include <stl2/view/repeat.hpp>
 #include <stl2/view/reverse.hpp>
 #include <stl2/view/single.hpp>
+#include <stl2/view/sliding.hpp>
 #include <stl2/view/split.hpp>
+#include <stl2/view/stride.hpp>
 #include <stl2/view/subrange.hpp>
 #include <stl2/view/take.hpp>
 #include <stl2/view/take_exactly.hpp>
 #include <stl2/view/take_while.hpp>
 #include <stl2/view/transform.hpp>
 #include <stl2/view/view_interface.hpp>
+#include <stl2/view/zip.hpp>
 
 #endif
@@ -0,0 +1,171 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_CACHE_LATEST_HPP
+#define STL2_VIEW_CACHE_LATEST_HPP
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/non_propagating_cache.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/view/view_closure.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/view_interface.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// cache_latest_view [Extension]
+//
+// An input view of the elements of a range that dereferences each
+// underlying iterator at most once: the first dereference of a position
+// stores its result in the view, and later dereferences of the same
+// position return the stored object.
+//
+STL2_OPEN_NAMESPACE {
+	template<View V>
+	requires InputRange<V>
+	class cache_latest_view : public view_interface<cache_latest_view<V>> {
+	private:
+		class __iterator;
+		class __sentinel;
+
+		using R = iter_reference_t<iterator_t<V>>;
+		using cache_t = meta::if_c<std::is_reference_v<R>,
+			std::add_pointer_t<R>, R>;
+
+		V base_ = V();
+		detail::non_propagating_cache<cache_t> cache_;
+
+	public:
+		cache_latest_view() = default;
+		constexpr explicit cache_latest_view(V base)
+		: base_(std::move(base)) {}
+
+		constexpr V base() const { return base_; }
+
+		constexpr __iterator begin()
+		{ return __iterator{*this}; }
+		constexpr __sentinel end()
+		{ return __sentinel{*this}; }
+
+		constexpr auto size() requires SizedRange<V>
+		{ return __stl2::size(base_); }
+		constexpr auto size() const requires SizedRange<const V>
+		{ return __stl2::size(base_); }
+	};
+
+	template<class R>
+	cache_latest_view(R&&) -> cache_latest_view<all_view<R>>;
+
+	template<View V>
+	requires InputRange<V>
+	class cache_latest_view<V>::__iterator {
+	private:
+		cache_latest_view* parent_ = nullptr;
+		iterator_t<V> current_ {};
+		friend __sentinel;
+	public:
+		using iterator_category = __stl2::input_iterator_tag;
+		using value_type = iter_value_t<iterator_t<V>>;
+		using difference_type = iter_difference_t<iterator_t<V>>;
+
+		__iterator() = default;
+
+		constexpr explicit __iterator(cache_latest_view& parent)
+		: parent_(&parent), current_(__stl2::begin(parent.base_)) {}
+
+		constexpr iterator_t<V> base() const
+		{ return current_; }
+
+		constexpr R& operator*() const {
+			auto& cache = parent_->cache_;
+			if constexpr (std::is_reference_v<R>) {
+				if (!cache) {
+					R r = *current_;
+					cache = std::addressof(r);
+				}
+				return **cache;
+			} else {
+				if (!cache) {
+					cache.emplace(*current_);
+				}
+				return *cache;
+			}
+		}
+
+		constexpr __iterator& operator++() {
+			parent_->cache_.reset();
+			++current_;
+			return *this;
+		}
+		constexpr void operator++(int)
+		{ ++*this; }
+
+		friend constexpr iter_rvalue_reference_t<iterator_t<V>>
+		iter_move(const __iterator& i)
+		STL2_NOEXCEPT_RETURN(
+			__stl2::iter_move(i.current_)
+		)
+		friend constexpr void iter_swap(const __iterator& x, const __iterator& y)
+		noexcept(noexcept(__stl2::iter_swap(x.current_, y.current_)))
+		requires IndirectlySwappable<iterator_t<V>>
+		{ __stl2::iter_swap(x.current_, y.current_); }
+	};
+
+	template<View V>
+	requires InputRange<V>
+	class cache_latest_view<V>::__sentinel {
+	private:
+		sentinel_t<V> end_ {};
+	public:
+		__sentinel() = default;
+		constexpr explicit __sentinel(cache_latest_view& parent)
+		: end_(__stl2::end(parent.base_)) {}
+
+		constexpr sentinel_t<V> base() const
+		{ return end_; }
+
+		friend constexpr bool operator==(const __iterator& x, const __sentinel& y)
+		{ return x.current_ == y.end_; }
+		friend constexpr bool operator==(const __sentinel& x, const __iterator& y)
+		{ return y == x; }
+		friend constexpr bool operator!=(const __iterator& x, const __sentinel& y)
+		{ return !(x == y); }
+		friend constexpr bool operator!=(const __sentinel& x, const __iterator& y)
+		{ return !(y == x); }
+
+		friend constexpr iter_difference_t<iterator_t<V>>
+		operator-(const __iterator& x, const __sentinel& y)
+		requires SizedSentinel<sentinel_t<V>, iterator_t<V>>
+		{ return x.current_ - y.end_; }
+		friend constexpr iter_difference_t<iterator_t<V>>
+		operator-(const __sentinel& x, const __iterator& y)
+		requires SizedSentinel<sentinel_t<V>, iterator_t<V>>
+		{ return x.end_ - y.current_; }
+	};
+
+	namespace view {
+		struct __cache_latest_fn : detail::__pipeable<__cache_latest_fn> {
+			template<ViewableRange Rng>
+			requires InputRange<Rng>
+			constexpr auto operator()(Rng&& rng) const
+			{ return cache_latest_view{std::forward<Rng>(rng)}; }
+		};
+
+		inline constexpr __cache_latest_fn cache_latest {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,429 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_CHUNK_HPP
+#define STL2_VIEW_CHUNK_HPP
+
+#include <utility>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/non_propagating_cache.hpp>
+#include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/iterator/default_sentinel.hpp>
+#include <stl2/detail/iterator/operations.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/view/view_closure.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/subrange.hpp>
+#include <stl2/view/view_interface.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// chunk_view [Extension]
+//
+// The successive n-element subranges of a range; the last may be shorter.
+// Over forward ranges each chunk is a subrange, and the view is as
+// traversable - and as sized - as the underlying range; stepping to the
+// next chunk is O(1) when the underlying range is random-access and
+// sized. Over input ranges the view caches its position instead, so each
+// element is read exactly once: advancing to the next chunk skips the
+// rest of the current one.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template<class I>
+		constexpr I __div_ceil(I num, I denom) {
+			I r = num / denom;
+			if (num % denom) ++r;
+			return r;
+		}
+	}
+
+	template<View V>
+	requires InputRange<V>
+	class chunk_view : public view_interface<chunk_view<V>> {
+	private:
+		using D = iter_difference_t<iterator_t<V>>;
+
+		class __outer_iterator;
+		class __inner_iterator;
+
+		V base_ = V();
+		D n_ = 0;
+		D remainder_ = 0;
+		detail::non_propagating_cache<iterator_t<V>> current_;
+
+	public:
+		chunk_view() = default;
+		constexpr chunk_view(V base, D n)
+		: base_(std::move(base)), n_(n)
+		{ STL2_EXPECT(n > 0); }
+
+		constexpr V base() const { return base_; }
+
+		constexpr __outer_iterator begin() {
+			current_ = __stl2::begin(base_);
+			remainder_ = n_;
+			return __outer_iterator{*this};
+		}
+
+		constexpr default_sentinel end() const noexcept { return {}; }
+
+		constexpr auto size() requires SizedRange<V> {
+			using S = decltype(__stl2::size(base_));
+			return static_cast<S>(
+				detail::__div_ceil(static_cast<D>(__stl2::size(base_)), n_));
+		}
+		constexpr auto size() const requires SizedRange<const V> {
+			using S = decltype(__stl2::size(base_));
+			return static_cast<S>(
+				detail::__div_ceil(static_cast<D>(__stl2::size(base_)), n_));
+		}
+	};
+
+	template<View V>
+	requires InputRange<V>
+	class chunk_view<V>::__outer_iterator {
+	private:
+		chunk_view* parent_ = nullptr;
+	public:
+		using iterator_category = __stl2::input_iterator_tag;
+		using difference_type = D;
+		struct value_type;
+
+		__outer_iterator() = default;
+		constexpr explicit __outer_iterator(chunk_view& parent)
+		: parent_(std::addressof(parent)) {}
+
+		constexpr value_type operator*() const
+		{ return value_type{*parent_}; }
+
+		constexpr __outer_iterator& operator++() {
+			__stl2::advance(*parent_->current_, parent_->remainder_,
+				__stl2::end(parent_->base_));
+			parent_->remainder_ = parent_->n_;
+			return *this;
+		}
+		constexpr void operator++(int)
+		{ ++*this; }
+
+		friend constexpr bool operator==(const __outer_iterator& x, default_sentinel) {
+			return *x.parent_->current_ == __stl2::end(x.parent_->base_) &&
+				x.parent_->remainder_ != 0;
+		}
+		friend constexpr bool operator==(default_sentinel x, const __outer_iterator& y)
+		{ return y == x; }
+		friend constexpr bool operator!=(const __outer_iterator& x, default_sentinel y)
+		{ return !(x == y); }
+		friend constexpr bool operator!=(default_sentinel x, const __outer_iterator& y)
+		{ return !(y == x); }
+
+		friend constexpr D operator-(default_sentinel, const __outer_iterator& x)
+		requires SizedSentinel<sentinel_t<V>, iterator_t<V>>
+		{
+			const D dist = __stl2::end(x.parent_->base_) - *x.parent_->current_;
+			if (dist < x.parent_->remainder_) return dist == 0 ? 0 : 1;
+			return detail::__div_ceil(dist - x.parent_->remainder_, x.parent_->n_) + 1;
+		}
+		friend constexpr D operator-(const __outer_iterator& x, default_sentinel y)
+		requires SizedSentinel<sentinel_t<V>, iterator_t<V>>
+		{ return -(y - x); }
+	};
+
+	template<View V>
+	requires InputRange<V>
+	struct chunk_view<V>::__outer_iterator::value_type
+	: view_interface<value_type> {
+	private:
+		chunk_view* parent_ = nullptr;
+	public:
+		value_type() = default;
+		constexpr explicit value_type(chunk_view& parent)
+		: parent_(std::addressof(parent)) {}
+
+		constexpr __inner_iterator begin() const
+		{ return __inner_iterator{*parent_}; }
+		constexpr default_sentinel end() const noexcept
+		{ return {}; }
+
+		constexpr auto size() const
+		requires SizedSentinel<sentinel_t<V>, iterator_t<V>>
+		{
+			const D dist = __stl2::end(parent_->base_) - *parent_->current_;
+			return static_cast<std::make_unsigned_t<D>>(
+				dist < parent_->remainder_ ? dist : parent_->remainder_);
+		}
+	};
+
+	template<View V>
+	requires InputRange<V>
+	class chunk_view<V>::__inner_iterator {
+	private:
+		chunk_view* parent_ = nullptr;
+	public:
+		using iterator_category = __stl2::input_iterator_tag;
+		using difference_type = D;
+		using value_type = iter_value_t<iterator_t<V>>;
+
+		__inner_iterator() = default;
+		constexpr explicit __inner_iterator(chunk_view& parent)
+		: parent_(std::addressof(parent)) {}
+
+		constexpr decltype(auto) operator*() const
+		{ return **parent_->current_; }
+
+		constexpr __inner_iterator& operator++() {
+			if (++*parent_->current_ == __stl2::end(parent_->base_)) {
+				parent_->remainder_ = 0;
+			} else {
+				--parent_->remainder_;
+			}
+			return *this;
+		}
+		constexpr void operator++(int)
+		{ ++*this; }
+
+		friend constexpr bool operator==(const __inner_iterator& x, default_sentinel)
+		{ return x.parent_->remainder_ == 0; }
+		friend constexpr bool operator==(default_sentinel x, const __inner_iterator& y)
+		{ return y == x; }
+		friend constexpr bool operator!=(const __inner_iterator& x, default_sentinel y)
+		{ return !(x == y); }
+		friend constexpr bool operator!=(default_sentinel x, const __inner_iterator& y)
+		{ return !(y == x); }
+
+		friend constexpr D operator-(default_sentinel, const __inner_iterator& x)
+		requires SizedSentinel<sentinel_t<V>, iterator_t<V>>
+		{
+			const D dist = __stl2::end(x.parent_->base_) - *x.parent_->current_;
+			return dist < x.parent_->remainder_ ? dist : x.parent_->remainder_;
+		}
+		friend constexpr D operator-(const __inner_iterator& x, default_sentinel y)
+		requires SizedSentinel<sentinel_t<V>, iterator_t<V>>
+		{ return -(y - x); }
+
+		friend constexpr decltype(auto) iter_move(const __inner_iterator& i)
+		STL2_NOEXCEPT_RETURN(
+			__stl2::iter_move(*i.parent_->current_)
+		)
+		friend constexpr void iter_swap(const __inner_iterator& x, const __inner_iterator& y)
+		noexcept(noexcept(__stl2::iter_swap(*x.parent_->current_, *y.parent_->current_)))
+		requires IndirectlySwappable<iterator_t<V>>
+		{ __stl2::iter_swap(*x.parent_->current_, *y.parent_->current_); }
+	};
+
+	template<View V>
+	requires ForwardRange<V>
+	class chunk_view<V> : public view_interface<chunk_view<V>> {
+	private:
+		using D = iter_difference_t<iterator_t<V>>;
+
+		template<bool> class __iterator;
+
+		V base_ = V();
+		D n_ = 0;
+
+	public:
+		chunk_view() = default;
+		constexpr chunk_view(V base, D n)
+		: base_(std::move(base)), n_(n)
+		{ STL2_EXPECT(n > 0); }
+
+		constexpr V base() const { return base_; }
+
+		constexpr auto begin() requires !ext::SimpleView<V>
+		{ return __iterator<false>{*this, __stl2::begin(base_)}; }
+		constexpr auto begin() const requires ForwardRange<const V>
+		{ return __iterator<true>{*this, __stl2::begin(base_)}; }
+
+		constexpr auto end() requires !ext::SimpleView<V>
+		{ return end_<false>(*this); }
+		constexpr auto end() const requires ForwardRange<const V>
+		{ return end_<true>(*this); }
+
+		constexpr auto size() requires SizedRange<V> {
+			using S = decltype(__stl2::size(base_));
+			return static_cast<S>(
+				detail::__div_ceil(static_cast<D>(__stl2::size(base_)), n_));
+		}
+		constexpr auto size() const requires SizedRange<const V> {
+			using S = decltype(__stl2::size(base_));
+			return static_cast<S>(
+				detail::__div_ceil(static_cast<D>(__stl2::size(base_)), n_));
+		}
+
+	private:
+		template<bool Const, class Self>
+		static constexpr auto end_(Self& self) {
+			using Base = __maybe_const<Const, V>;
+			if constexpr (CommonRange<Base> && SizedRange<Base>) {
+				const auto missing = (self.n_ - static_cast<D>(__stl2::size(self.base_))
+					% self.n_) % self.n_;
+				return __iterator<Const>{self, __stl2::end(self.base_), missing};
+			} else if constexpr (CommonRange<Base> && !BidirectionalRange<Base>) {
+				return __iterator<Const>{self, __stl2::end(self.base_)};
+			} else {
+				return default_sentinel{};
+			}
+		}
+	};
+
+	template<View V>
+	requires ForwardRange<V>
+	template<bool Const>
+	class chunk_view<V>::__iterator {
+	private:
+		using Parent = __maybe_const<Const, chunk_view>;
+		using Base = __maybe_const<Const, V>;
+
+		iterator_t<Base> current_ {};
+		sentinel_t<Base> end_ {};
+		D n_ = 0;
+		// How many elements short of n the last chunk is, once current_
+		// has reached end_.
+		D missing_ = 0;
+		friend __iterator<!Const>;
+	public:
+		using iterator_category = iterator_category_t<iterator_t<Base>>;
+		using value_type = subrange<iterator_t<Base>>;
+		using difference_type = D;
+
+		__iterator() = default;
+
+		constexpr __iterator(Parent& parent, iterator_t<Base> current, D missing = 0)
+		: current_(std::move(current)), end_(__stl2::end(parent.base_))
+		, n_(parent.n_), missing_(missing) {}
+
+		constexpr __iterator(__iterator<!Const> i)
+		requires Const && ConvertibleTo<iterator_t<V>, iterator_t<Base>> &&
+			ConvertibleTo<sentinel_t<V>, sentinel_t<Base>>
+		: current_(std::move(i.current_)), end_(std::move(i.end_))
+		, n_(i.n_), missing_(i.missing_) {}
+
+		constexpr iterator_t<Base> base() const
+		{ return current_; }
+
+		constexpr value_type operator*() const {
+			STL2_EXPECT(current_ != end_);
+			return {current_, __stl2::next(current_, n_, end_)};
+		}
+
+		constexpr __iterator& operator++() {
+			STL2_EXPECT(current_ != end_);
+			missing_ = __stl2::advance(current_, n_, end_);
+			return *this;
+		}
+		constexpr __iterator operator++(int) {
+			auto tmp = *this;
+			++*this;
+			return tmp;
+		}
+
+		constexpr __iterator& operator--() requires BidirectionalRange<Base> {
+			__stl2::advance(current_, missing_ - n_);
+			missing_ = 0;
+			return *this;
+		}
+		constexpr __iterator operator--(int) requires BidirectionalRange<Base> {
+			auto tmp = *this;
+			--*this;
+			return tmp;
+		}
+
+		constexpr __iterator& operator+=(difference_type x)
+		requires RandomAccessRange<Base>
+		{
+			if (x > 0) {
+				missing_ = __stl2::advance(current_, n_ * x, end_);
+			} else if (x < 0) {
+				__stl2::advance(current_, n_ * x + missing_);
+				missing_ = 0;
+			}
+			return *this;
+		}
+		constexpr __iterator& operator-=(difference_type x)
+		requires RandomAccessRange<Base>
+		{ return *this += -x; }
+		constexpr value_type operator[](difference_type x) const
+		requires RandomAccessRange<Base>
+		{ return *(*this + x); }
+
+		friend constexpr bool operator==(const __iterator& x, const __iterator& y)
+		{ return x.current_ == y.current_; }
+		friend constexpr bool operator!=(const __iterator& x, const __iterator& y)
+		{ return !(x == y); }
+
+		friend constexpr bool operator==(const __iterator& x, default_sentinel)
+		{ return x.current_ == x.end_; }
+		friend constexpr bool operator==(default_sentinel x, const __iterator& y)
+		{ return y == x; }
+		friend constexpr bool operator!=(const __iterator& x, default_sentinel y)
+		{ return !(x == y); }
+		friend constexpr bool operator!=(default_sentinel x, const __iterator& y)
+		{ return !(y == x); }
+
+		friend constexpr bool operator<(const __iterator& x, const __iterator& y)
+		requires RandomAccessRange<Base>
+		{ return x.current_ < y.current_; }
+		friend constexpr bool operator>(const __iterator& x, const __iterator& y)
+		requires RandomAccessRange<Base>
+		{ return y < x; }
+		friend constexpr bool operator<=(const __iterator& x, const __iterator& y)
+		requires RandomAccessRange<Base>
+		{ return !(y < x); }
+		friend constexpr bool operator>=(const __iterator& x, const __iterator& y)
+		requires RandomAccessRange<Base>
+		{ return !(x < y); }
+
+		friend constexpr __iterator operator+(__iterator i, difference_type n)
+		requires RandomAccessRange<Base>
+		{ return i += n; }
+		friend constexpr __iterator operator+(difference_type n, __iterator i)
+		requires RandomAccessRange<Base>
+		{ return i += n; }
+		friend constexpr __iterator operator-(__iterator i, difference_type n)
+		requires RandomAccessRange<Base>
+		{ return i -= n; }
+
+		friend constexpr difference_type operator-(const __iterator& x, const __iterator& y)
+		requires SizedSentinel<iterator_t<Base>, iterator_t<Base>>
+		{ return (x.current_ - y.current_ + x.missing_ - y.missing_) / x.n_; }
+
+		friend constexpr difference_type operator-(default_sentinel, const __iterator& x)
+		requires SizedSentinel<sentinel_t<Base>, iterator_t<Base>>
+		{ return detail::__div_ceil(static_cast<D>(x.end_ - x.current_), x.n_); }
+		friend constexpr difference_type operator-(const __iterator& x, default_sentinel y)
+		requires SizedSentinel<sentinel_t<Base>, iterator_t<Base>>
+		{ return -(y - x); }
+	};
+
+	template<class R>
+	chunk_view(R&&, iter_difference_t<iterator_t<R>>) -> chunk_view<all_view<R>>;
+
+	namespace view {
+		struct __chunk_fn {
+			template<ViewableRange Rng>
+			requires InputRange<Rng>
+			constexpr auto operator()(Rng&& rng, iter_difference_t<iterator_t<Rng>> n) const
+			{ return chunk_view{std::forward<Rng>(rng), n}; }
+
+			template<Integral D>
+			constexpr auto operator()(D n) const
+			{ return detail::view_closure{*this, static_cast<D>(n)}; }
+		};
+
+		inline constexpr __chunk_fn chunk {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -20,6 +20,7 @@
 #include <stl2/detail/iterator/concepts.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/partition.hpp>
 #include <stl2/detail/range/nth_iterator.hpp>
 #include <stl2/detail/view/view_closure.hpp>
 #include <stl2/view/all.hpp>
@@ -54,6 +55,19 @@ STL2_OPEN_NAMESPACE {
 
 			constexpr auto size() requires !SimpleView<R> && SizedRange<R> { return size_impl(*this); }
 			constexpr auto size() const requires SizedRange<const R> { return size_impl(*this); }
+
+			// Extension: split the trailing elements of a random-access,
+			// sized underlying range without finding - or caching - begin().
+			friend auto partition_range(const drop_view& r, D k)
+			requires RandomAccessRange<const R> && SizedRange<const R>
+			{
+				const auto size = static_cast<D>(__stl2::size(r.base_));
+				const D m = r.count_ < size ? r.count_ : size;
+				auto first = __stl2::begin(r.base_) + m;
+				return detail::__partition_by_bounds(size - m, k, [&first](D lo, D hi) {
+					return subrange{first + lo, first + hi};
+				});
+			}
 		private:
 			R base_;
 			D count_;
@@ -20,6 +20,7 @@
 #include <stl2/detail/iterator/concepts.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/partition.hpp>
 #include <stl2/detail/view/view_closure.hpp>
 #include <stl2/view/all.hpp>
 #include <stl2/view/view_interface.hpp>
@@ -61,6 +62,18 @@ STL2_OPEN_NAMESPACE {
 
 		constexpr __iterator end() requires CommonRange<V>
 		{ return __iterator{*this, __stl2::end(base_)}; }
+
+		// Extension: split the underlying range, and filter each piece.
+		friend auto partition_range(const filter_view& r,
+			iter_difference_t<iterator_t<V>> k)
+		requires ext::PartitionableRange<const V&>
+		{
+			return detail::__adapt_partition(ext::partition_range(r.base_, k),
+				[&r](auto&& piece) {
+					return filter_view<ext::partition_piece_t<const V&>, Pred>{
+						std::move(piece), r.pred_.get()};
+				});
+		}
 	};
 
 	template<InputRange V, IndirectUnaryPredicate<iterator_t<V>> Pred>
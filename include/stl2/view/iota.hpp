@@ -19,6 +19,7 @@
 #include <stl2/detail/concepts/compare.hpp>
 #include <stl2/detail/iterator/basic_iterator.hpp>
 #include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/range/partition.hpp>
 #include <stl2/view/view_interface.hpp>
 
 STL2_OPEN_NAMESPACE {
@@ -45,6 +46,13 @@ STL2_OPEN_NAMESPACE {
 	requires WeaklyEqualityComparable<I, Bound>
 	struct iota_view;
 
+	namespace detail {
+		template<class I>
+		inline constexpr bool __unbounded_range<iota_view<I>> = true;
+		template<class I>
+		inline constexpr bool __unbounded_range<const iota_view<I>> = true;
+	}
+
 	namespace __iota_view_detail {
 		struct __adl_hook {};
 
@@ -93,6 +101,21 @@ STL2_OPEN_NAMESPACE {
 			(Integral<II> && Integral<BB>) ||
 			SizedSentinel<BB, II>
 		{ return bound_ - value_; }
+
+		// Extension: split into smaller iota_views.
+		friend auto partition_range(const iota_view& r, iter_difference_t<I> k)
+		requires Same<I, Bound> && ext::RandomAccessIncrementable<I>
+		{
+			using D = iter_difference_t<I>;
+			return detail::__partition_by_bounds(static_cast<D>(r.bound_ - r.value_), k,
+				[&r](D lo, D hi) {
+					I first = r.value_;
+					I last = r.value_;
+					first += lo;
+					last += hi;
+					return iota_view<I, I>{first, last};
+				});
+		}
 	};
 
 	template<WeaklyIncrementable I, Semiregular Bound>
@@ -13,8 +13,15 @@
 #ifndef STL2_VIEW_ISTREAM_HPP
 #define STL2_VIEW_ISTREAM_HPP
 
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
 #include <istream>
 #include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
 
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/raw_ptr.hpp>
@@ -85,6 +92,192 @@ STL2_OPEN_NAMESPACE {
 		private:
 			detail::raw_ptr<istream_view<Val>> parent_ = nullptr;
 		};
+
+		///////////////////////////////////////////////////////////////////////////
+		// bulk_istream_view [Extension]
+		//
+		// The whitespace-separated numbers in a stream, like istream_view,
+		// but read from the stream's buffer a block at a time with sgetn
+		// and parsed with from_chars, rather than extracted one at a time
+		// with operator>>. Numbers are in the "C" locale's format, with an
+		// optional leading '+' - and, as operator>> allows, a leading '-'
+		// for unsigned types, which negates modulo 2^N; the first token
+		// that isn't one ends the range and sets failbit, like a failed
+		// extraction.
+		//
+		// The view reads ahead of the values it has parsed, so the stream's
+		// position is unspecified once iteration has begun. Copies of a
+		// view share its buffer and position, as copies of istream_view
+		// share the stream's.
+		//
+		template<class Val>
+		META_CONCEPT __bulk_extractable = std::is_arithmetic_v<Val> &&
+			!Same<std::remove_cv_t<Val>, bool> &&
+			!Same<std::remove_cv_t<Val>, char> &&
+			!Same<std::remove_cv_t<Val>, signed char> &&
+			!Same<std::remove_cv_t<Val>, unsigned char> &&
+			!Same<std::remove_cv_t<Val>, wchar_t> &&
+			!Same<std::remove_cv_t<Val>, char16_t> &&
+			!Same<std::remove_cv_t<Val>, char32_t>;
+
+		template<__bulk_extractable Val>
+		struct __bulk_istream_state {
+			// Positions are indices so that growing the buffer keeps them.
+			std::istream* sin_;
+			std::vector<char> buf_;
+			std::size_t pos_ = 0;
+			std::size_t end_ = 0;
+			bool eof_ = false;
+			bool done_ = false;
+			Val value_ {};
+
+			__bulk_istream_state(std::istream& sin, std::size_t block)
+			: sin_{std::addressof(sin)}, buf_(block) {}
+
+			static constexpr bool is_space_(char c) noexcept {
+				return c == ' ' || (c >= '\t' && c <= '\r');
+			}
+
+			// Discard [0, keep), read more after what remains, and return
+			// the number of bytes read.
+			std::size_t fill_(std::size_t keep) {
+				const auto kept = end_ - keep;
+				std::memmove(buf_.data(), buf_.data() + keep, kept);
+				if (kept == buf_.size()) {
+					buf_.resize(buf_.size() * 2); // a token longer than a block
+				}
+				const auto n = static_cast<std::size_t>(sin_->rdbuf()->sgetn(
+					buf_.data() + kept, static_cast<std::streamsize>(buf_.size() - kept)));
+				pos_ = 0;
+				end_ = kept + n;
+				eof_ = n == 0;
+				return n;
+			}
+
+			static bool parse_(const char* first, const char* last, Val& v) {
+				if (last - first > 1 && *first == '+' && first[1] != '-') ++first;
+				if constexpr (std::is_unsigned_v<Val>) {
+					if (last - first > 1 && *first == '-' &&
+						first[1] != '+' && first[1] != '-')
+					{
+						if (!parse_(first + 1, last, v)) return false;
+						v = static_cast<Val>(Val(0) - v);
+						return true;
+					}
+				}
+				if constexpr (requires { std::from_chars(first, last, v); }) {
+					const auto [p, ec] = std::from_chars(first, last, v);
+					return ec == std::errc{} && p == last;
+				} else {
+					// No floating-point from_chars.
+					const std::string token(first, last);
+					char* p = nullptr;
+					if constexpr (Same<std::remove_cv_t<Val>, float>) {
+						v = std::strtof(token.c_str(), &p);
+					} else if constexpr (Same<std::remove_cv_t<Val>, double>) {
+						v = std::strtod(token.c_str(), &p);
+					} else {
+						v = std::strtold(token.c_str(), &p);
+					}
+					return p == token.c_str() + token.size();
+				}
+			}
+
+			void finish_(std::ios_base::iostate state) {
+				done_ = true;
+				sin_->setstate(state);
+			}
+
+			void next_() {
+				for (;;) {
+					while (pos_ != end_ && is_space_(buf_[pos_])) ++pos_;
+					if (pos_ == end_) {
+						if (eof_ || fill_(end_) == 0) {
+							return finish_(std::ios_base::eofbit | std::ios_base::failbit);
+						}
+						continue;
+					}
+					auto last = pos_;
+					while (last != end_ && !is_space_(buf_[last])) ++last;
+					if (last == end_ && !eof_) {
+						// The token may continue in the next block.
+						fill_(pos_);
+						continue;
+					}
+					if (!parse_(buf_.data() + pos_, buf_.data() + last, value_)) {
+						return finish_(std::ios_base::failbit);
+					}
+					pos_ = last;
+					return;
+				}
+			}
+		};
+
+		template<__bulk_extractable Val>
+		struct bulk_istream_view : view_interface<bulk_istream_view<Val>> {
+		private:
+			struct __iterator;
+
+			static constexpr std::size_t default_block = 64 * 1024;
+
+			detail::raw_ptr<std::istream> sin_ = nullptr;
+			std::size_t block_ = default_block;
+			// Allocated by begin(), so that an unread view owns no buffer.
+			std::shared_ptr<__bulk_istream_state<Val>> state_;
+		public:
+			bulk_istream_view() = default;
+			explicit bulk_istream_view(std::istream& sin,
+				std::size_t block_size = default_block) noexcept
+			: sin_{std::addressof(sin)}, block_{block_size ? block_size : 1} {}
+
+			__iterator begin() {
+				state_ = std::make_shared<__bulk_istream_state<Val>>(*sin_, block_);
+				std::istream::sentry sentry{*sin_, true};
+				if (!sentry) {
+					state_->done_ = true;
+				} else {
+					state_->next_(); // prime the pump
+				}
+				return __iterator{*state_};
+			}
+
+			constexpr default_sentinel end() const noexcept { return {}; }
+		};
+
+		template<__bulk_extractable Val>
+		struct bulk_istream_view<Val>::__iterator {
+			using iterator_category = input_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = Val;
+
+			__iterator() = default;
+			explicit constexpr __iterator(__bulk_istream_state<Val>& state) noexcept
+			: state_{std::addressof(state)} {}
+
+			__iterator& operator++() {
+				state_->next_();
+				return *this;
+			}
+			void operator++(int) { ++*this; }
+
+			Val& operator*() const { return state_->value_; }
+			Val* operator->() const { return std::addressof(state_->value_); }
+
+			friend bool operator==(__iterator x, default_sentinel) {
+				return x.state_->done_;
+			}
+			friend bool operator==(default_sentinel y, __iterator x) {
+				return x == y;
+			}
+			friend bool operator!=(__iterator x, default_sentinel y) {
+				return !(x == y);
+			}
+			friend bool operator!=(default_sentinel y, __iterator x) {
+				return !(y == x);
+			}
+		private:
+			detail::raw_ptr<__bulk_istream_state<Val>> state_ = nullptr;
+		};
 	} // namespace ext
 
 	namespace view {
@@ -97,6 +290,20 @@ STL2_OPEN_NAMESPACE {
 
 		template<class Val>
 		inline constexpr __istream_fn<Val> istream{};
+
+		namespace ext {
+			template<class Val>
+			requires requires { typename __stl2::ext::bulk_istream_view<Val>; }
+			struct __bulk_istream_fn {
+				auto operator()(std::istream& sin) const noexcept
+				{ return __stl2::ext::bulk_istream_view<Val>{sin}; }
+				auto operator()(std::istream& sin, std::size_t block_size) const noexcept
+				{ return __stl2::ext::bulk_istream_view<Val>{sin, block_size}; }
+			};
+
+			template<class Val>
+			inline constexpr __bulk_istream_fn<Val> bulk_istream{};
+		} // namespace ext
 	} // namespace view
 } STL2_CLOSE_NAMESPACE
 
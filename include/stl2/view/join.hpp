@@ -15,8 +15,10 @@
 #include <stl2/type_traits.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/partition.hpp>
 #include <stl2/view/all.hpp>
 #include <stl2/view/view_interface.hpp>
 #include <stl2/detail/view/view_closure.hpp>
@@ -108,6 +110,18 @@ STL2_OPEN_NAMESPACE {
 				return __sentinel<true>{*this};
 			}
 		}
+
+		// Extension: split the outer range, so that each piece joins whole
+		// inner ranges.
+		friend auto partition_range(const join_view& r,
+			iter_difference_t<iterator_t<V>> k)
+		requires ext::PartitionableRange<const V&>
+		{
+			return detail::__adapt_partition(ext::partition_range(r.base_, k),
+				[](auto&& piece) {
+					return join_view<ext::partition_piece_t<const V&>>{std::move(piece)};
+				});
+		}
 	};
 
 	template<class R>
@@ -133,6 +147,31 @@ STL2_OPEN_NAMESPACE {
 		friend __iterator<true>;
 		friend __sentinel<Const>;
 
+		using InnerIter = iterator_t<iter_reference_t<iterator_t<Base>>>;
+
+		// The elements of one inner range from inner to last, for
+		// for_each_segment.
+		struct segment {
+			Parent* parent_;
+			iterator_t<Base> outer_;
+			InnerIter first_, last_;
+
+			constexpr InnerIter begin() const { return first_; }
+			constexpr InnerIter end() const { return last_; }
+			constexpr __iterator compose(InnerIter i) const {
+				return __iterator{*parent_, outer_, std::move(i)};
+			}
+		};
+
+		constexpr __iterator(Parent& parent, iterator_t<Base> outer, InnerIter inner)
+		: outer_(std::move(outer)), inner_(std::move(inner))
+		, parent_(std::addressof(parent)) {
+			if (inner_ == __stl2::end(*outer_)) {
+				++outer_;
+				satisfy_();
+			}
+		}
+
 		constexpr void satisfy_() {
 			auto update_inner_range =
 				[this](iter_reference_t<iterator_t<Base>> x) -> decltype(auto) {
@@ -246,6 +285,28 @@ STL2_OPEN_NAMESPACE {
 		friend constexpr void iter_swap(const __iterator& x, const __iterator& y)
 		noexcept(noexcept(__stl2::iter_swap(x.inner_, y.inner_)))
 		{ __stl2::iter_swap(x.inner_, y.inner_); }
+
+		// Extension: segmented iteration, one inner range at a time.
+		template<class F>
+		friend constexpr void for_each_segment(const __iterator& first,
+			const __iterator& last, F&& f)
+		requires ref_is_glvalue && ForwardRange<Base> &&
+			ForwardRange<iter_reference_t<iterator_t<Base>>>
+		{
+			const auto end = __stl2::end(first.parent_->base_);
+			auto outer = first.outer_;
+			auto inner = first.inner_;
+			while (outer != last.outer_) {
+				if (!f(segment{first.parent_, outer, std::move(inner), __stl2::end(*outer)})) {
+					return;
+				}
+				if (++outer == end) return;
+				inner = __stl2::begin(*outer);
+			}
+			if (outer != end) {
+				f(segment{first.parent_, std::move(outer), std::move(inner), last.inner_});
+			}
+		}
 	};
 
 	template<InputRange V>
@@ -0,0 +1,172 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_MAPPED_FILE_HPP
+#define STL2_VIEW_MAPPED_FILE_HPP
+
+#if __has_include(<sys/mman.h>)
+#include <cerrno>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/view/view_interface.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// mapped_file_view [Extension]
+//
+// A contiguous view of the contents of a file, read in place through a
+// shared memory mapping instead of being copied into a buffer. Copies of
+// a mapped_file_view share the mapping, which is unmapped when the last
+// of them is destroyed. A view of const elements maps the file read-only;
+// stores through a view of mutable elements write to the file.
+//
+// The view denotes the whole elements in the file: trailing bytes that
+// do not fill an element are not part of it.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		// Hints to the kernel about how a mapped_file_view will be accessed.
+		enum class mapped_file_advice {
+			normal,
+			sequential, // read ahead aggressively, drop pages once visited
+			random,     // do not read ahead
+			willneed,   // start reading the whole file in now
+			hugepage,   // back the mapping with huge pages, where supported
+		};
+	}
+
+	namespace detail {
+		class __file_mapping {
+		public:
+			__file_mapping(void* addr, std::size_t bytes) noexcept
+			: addr_{addr}, bytes_{bytes} {}
+			__file_mapping(const __file_mapping&) = delete;
+			__file_mapping& operator=(const __file_mapping&) = delete;
+			~__file_mapping() { ::munmap(addr_, bytes_); }
+
+			void* data() const noexcept { return addr_; }
+			std::size_t bytes() const noexcept { return bytes_; }
+
+			// Map all of the file at path, or return nullptr if it is empty.
+			static std::shared_ptr<__file_mapping> map(const char* path, bool writable) {
+				const int fd = ::open(path, (writable ? O_RDWR : O_RDONLY) | O_CLOEXEC);
+				if (fd < 0) {
+					fail("open");
+				}
+				struct stat st;
+				if (::fstat(fd, &st) != 0) {
+					close_and_fail(fd, "fstat");
+				}
+				const auto bytes = static_cast<std::size_t>(st.st_size);
+				if (bytes == 0) {
+					::close(fd);
+					return nullptr;
+				}
+				const int prot = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+				void* const addr = ::mmap(nullptr, bytes, prot, MAP_SHARED, fd, 0);
+				if (addr == MAP_FAILED) {
+					close_and_fail(fd, "mmap");
+				}
+				// The mapping keeps the file open.
+				::close(fd);
+				return std::make_shared<__file_mapping>(addr, bytes);
+			}
+
+			bool advise(ext::mapped_file_advice advice) const noexcept {
+				int flag = MADV_NORMAL;
+				switch (advice) {
+				case ext::mapped_file_advice::normal: flag = MADV_NORMAL; break;
+				case ext::mapped_file_advice::sequential: flag = MADV_SEQUENTIAL; break;
+				case ext::mapped_file_advice::random: flag = MADV_RANDOM; break;
+				case ext::mapped_file_advice::willneed: flag = MADV_WILLNEED; break;
+				case ext::mapped_file_advice::hugepage:
+#ifdef MADV_HUGEPAGE
+					flag = MADV_HUGEPAGE; break;
+#else
+					return false;
+#endif
+				}
+				return ::madvise(addr_, bytes_, flag) == 0;
+			}
+
+		private:
+			void* addr_;
+			std::size_t bytes_;
+
+			[[noreturn]] static void fail(const char* what) {
+				throw std::system_error{errno, std::generic_category(),
+					std::string{"mapped_file_view: "} + what};
+			}
+			[[noreturn]] static void close_and_fail(int fd, const char* what) {
+				const int error = errno;
+				::close(fd);
+				errno = error;
+				fail(what);
+			}
+		};
+	}
+
+	namespace ext {
+		template<class T = const char>
+		requires std::is_trivially_copyable_v<T> && !std::is_volatile_v<T>
+		class mapped_file_view : public view_interface<mapped_file_view<T>> {
+		public:
+			using element_type = T;
+
+			mapped_file_view() = default;
+
+			// Throws std::system_error if the file cannot be opened or mapped.
+			explicit mapped_file_view(const char* path,
+				mapped_file_advice advice = mapped_file_advice::normal)
+			: mapping_{detail::__file_mapping::map(path, !std::is_const_v<T>)}
+			{
+				if (mapping_) {
+					data_ = static_cast<T*>(mapping_->data());
+					size_ = static_cast<std::ptrdiff_t>(mapping_->bytes() / sizeof(T));
+					if (advice != mapped_file_advice::normal) {
+						mapping_->advise(advice);
+					}
+				}
+			}
+			explicit mapped_file_view(const std::string& path,
+				mapped_file_advice advice = mapped_file_advice::normal)
+			: mapped_file_view{path.c_str(), advice} {}
+
+			T* begin() const noexcept { return data_; }
+			T* end() const noexcept { return data_ + size_; }
+			T* data() const noexcept { return data_; }
+			std::ptrdiff_t size() const noexcept { return size_; }
+
+			// Change the access hint for the mapping. Returns false if the
+			// system rejects or does not support the hint, which does not
+			// affect the contents of the view.
+			bool advise(mapped_file_advice advice) const noexcept {
+				return mapping_ && mapping_->advise(advice);
+			}
+
+		private:
+			std::shared_ptr<detail::__file_mapping> mapping_;
+			T* data_ = nullptr;
+			std::ptrdiff_t size_ = 0;
+		};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif // __has_include(<sys/mman.h>)
+#endif
@@ -17,6 +17,7 @@
 #include <stl2/detail/iterator/reverse_iterator.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/partition.hpp>
 #include <stl2/detail/view/view_closure.hpp>
 #include <stl2/view/all.hpp>
 #include <stl2/view/view_interface.hpp>
@@ -72,6 +73,23 @@ STL2_OPEN_NAMESPACE {
 		constexpr auto size() const requires SizedRange<const V> {
 			return __stl2::size(base_);
 		}
+
+		// Extension: split the underlying range, and reverse both the
+		// order of the pieces and each piece.
+		friend auto partition_range(const reverse_view& r,
+			iter_difference_t<iterator_t<V>> k)
+		requires ext::PartitionableRange<const V&> &&
+			BidirectionalRange<ext::partition_piece_t<const V&>>
+		{
+			using P = ext::partition_piece_t<const V&>;
+			auto pieces = ext::partition_range(r.base_, k);
+			std::vector<reverse_view<P>> result;
+			result.reserve(pieces.size());
+			for (auto i = pieces.size(); i-- > 0;) {
+				result.emplace_back(std::move(pieces[i]));
+			}
+			return result;
+		}
 	};
 
 	template<class R>
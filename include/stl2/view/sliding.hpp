@@ -0,0 +1,270 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_SLIDING_HPP
+#define STL2_VIEW_SLIDING_HPP
+
+#include <utility>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/cached_position.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/iterator/operations.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/view/view_closure.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/subrange.hpp>
+#include <stl2/view/view_interface.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// sliding_view [Extension]
+//
+// The n-element windows of a forward range: the subranges [i, i + n) for
+// each position i at least n elements from the end. Each iterator holds
+// both ends of its window, so stepping is O(1) on any forward range.
+// The view is as traversable, sized, and common as the underlying range.
+//
+STL2_OPEN_NAMESPACE {
+	template<View V>
+	requires ForwardRange<V>
+	class sliding_view : public view_interface<sliding_view<V>> {
+	private:
+		using D = iter_difference_t<iterator_t<V>>;
+
+		template<bool> class __iterator;
+		template<bool> class __sentinel;
+
+		V base_ = V();
+		D n_ = 0;
+		// The end of the first window, unless that's O(1) to find.
+		detail::cached_position<V, sliding_view,
+			!(RandomAccessRange<V> && SizedRange<V>)> first_end_;
+
+		template<bool Const, class Self>
+		static constexpr auto begin_(Self& self) {
+			auto first = __stl2::begin(self.base_);
+			if constexpr (Const || (RandomAccessRange<V> && SizedRange<V>)) {
+				auto last = __stl2::next(first, self.n_ - 1, __stl2::end(self.base_));
+				return __iterator<Const>{std::move(first), std::move(last)};
+			} else {
+				if (!self.first_end_) {
+					self.first_end_.set(self.base_,
+						__stl2::next(first, self.n_ - 1, __stl2::end(self.base_)));
+				}
+				return __iterator<Const>{std::move(first), self.first_end_.get(self.base_)};
+			}
+		}
+
+		template<bool Const, class Self>
+		static constexpr auto end_(Self& self) {
+			using Base = __maybe_const<Const, V>;
+			if constexpr (RandomAccessRange<Base> && SizedRange<Base>) {
+				return begin_<Const>(self) + static_cast<D>(self.size());
+			} else if constexpr (CommonRange<Base>) {
+				auto last = __stl2::end(self.base_);
+				if constexpr (BidirectionalRange<Base>) {
+					auto first = __stl2::prev(last, self.n_ - 1, __stl2::begin(self.base_));
+					return __iterator<Const>{std::move(first), std::move(last)};
+				} else {
+					return __iterator<Const>{last, last};
+				}
+			} else {
+				return __sentinel<Const>{__stl2::end(self.base_)};
+			}
+		}
+
+	public:
+		sliding_view() = default;
+		constexpr sliding_view(V base, D n)
+		: base_(std::move(base)), n_(n)
+		{ STL2_EXPECT(n > 0); }
+
+		constexpr V base() const { return base_; }
+
+		// Without random access, the first window is found once and cached.
+		constexpr auto begin() requires !(ext::SimpleView<V> &&
+			RandomAccessRange<const V> && SizedRange<const V>)
+		{ return begin_<false>(*this); }
+		constexpr auto begin() const requires RandomAccessRange<const V> && SizedRange<const V>
+		{ return begin_<true>(*this); }
+
+		constexpr auto end() requires !(ext::SimpleView<V> &&
+			RandomAccessRange<const V> && SizedRange<const V>)
+		{ return end_<false>(*this); }
+		constexpr auto end() const requires RandomAccessRange<const V> && SizedRange<const V>
+		{ return end_<true>(*this); }
+
+		constexpr auto size() requires SizedRange<V> {
+			using S = decltype(__stl2::size(base_));
+			const auto k = static_cast<D>(__stl2::size(base_)) - n_ + 1;
+			return static_cast<S>(k < 0 ? 0 : k);
+		}
+		constexpr auto size() const requires SizedRange<const V> {
+			using S = decltype(__stl2::size(base_));
+			const auto k = static_cast<D>(__stl2::size(base_)) - n_ + 1;
+			return static_cast<S>(k < 0 ? 0 : k);
+		}
+	};
+
+	template<View V>
+	requires ForwardRange<V>
+	template<bool Const>
+	class sliding_view<V>::__iterator {
+	private:
+		using Base = __maybe_const<Const, V>;
+
+		// The window is [current_, last_]; the iterator is past the end once
+		// last_ is.
+		iterator_t<Base> current_ {};
+		iterator_t<Base> last_ {};
+		friend __iterator<!Const>;
+		friend __sentinel<Const>;
+	public:
+		using iterator_category = iterator_category_t<iterator_t<Base>>;
+		using value_type = subrange<iterator_t<Base>>;
+		using difference_type = D;
+
+		__iterator() = default;
+
+		constexpr __iterator(iterator_t<Base> current, iterator_t<Base> last)
+		: current_(std::move(current)), last_(std::move(last)) {}
+
+		constexpr __iterator(__iterator<!Const> i)
+		requires Const && ConvertibleTo<iterator_t<V>, iterator_t<Base>>
+		: current_(std::move(i.current_)), last_(std::move(i.last_)) {}
+
+		constexpr iterator_t<Base> base() const
+		{ return current_; }
+
+		constexpr value_type operator*() const
+		{ return {current_, __stl2::next(last_)}; }
+
+		constexpr __iterator& operator++() {
+			++current_;
+			++last_;
+			return *this;
+		}
+		constexpr __iterator operator++(int) {
+			auto tmp = *this;
+			++*this;
+			return tmp;
+		}
+
+		constexpr __iterator& operator--() requires BidirectionalRange<Base> {
+			--current_;
+			--last_;
+			return *this;
+		}
+		constexpr __iterator operator--(int) requires BidirectionalRange<Base> {
+			auto tmp = *this;
+			--*this;
+			return tmp;
+		}
+
+		constexpr __iterator& operator+=(difference_type n)
+		requires RandomAccessRange<Base>
+		{
+			current_ += n;
+			last_ += n;
+			return *this;
+		}
+		constexpr __iterator& operator-=(difference_type n)
+		requires RandomAccessRange<Base>
+		{ return *this += -n; }
+		constexpr value_type operator[](difference_type n) const
+		requires RandomAccessRange<Base>
+		{ return *(*this + n); }
+
+		friend constexpr bool operator==(const __iterator& x, const __iterator& y)
+		{ return x.last_ == y.last_; }
+		friend constexpr bool operator!=(const __iterator& x, const __iterator& y)
+		{ return !(x == y); }
+
+		friend constexpr bool operator<(const __iterator& x, const __iterator& y)
+		requires RandomAccessRange<Base>
+		{ return x.last_ < y.last_; }
+		friend constexpr bool operator>(const __iterator& x, const __iterator& y)
+		requires RandomAccessRange<Base>
+		{ return y < x; }
+		friend constexpr bool operator<=(const __iterator& x, const __iterator& y)
+		requires RandomAccessRange<Base>
+		{ return !(y < x); }
+		friend constexpr bool operator>=(const __iterator& x, const __iterator& y)
+		requires RandomAccessRange<Base>
+		{ return !(x < y); }
+
+		friend constexpr __iterator operator+(__iterator i, difference_type n)
+		requires RandomAccessRange<Base>
+		{ return i += n; }
+		friend constexpr __iterator operator+(difference_type n, __iterator i)
+		requires RandomAccessRange<Base>
+		{ return i += n; }
+		friend constexpr __iterator operator-(__iterator i, difference_type n)
+		requires RandomAccessRange<Base>
+		{ return i -= n; }
+
+		friend constexpr difference_type operator-(const __iterator& x, const __iterator& y)
+		requires SizedSentinel<iterator_t<Base>, iterator_t<Base>>
+		{ return x.last_ - y.last_; }
+	};
+
+	template<View V>
+	requires ForwardRange<V>
+	template<bool Const>
+	class sliding_view<V>::__sentinel {
+	private:
+		using Base = __maybe_const<Const, V>;
+		sentinel_t<Base> end_ {};
+	public:
+		__sentinel() = default;
+		constexpr explicit __sentinel(sentinel_t<Base> end)
+		: end_(std::move(end)) {}
+
+		friend constexpr bool operator==(const __iterator<Const>& x, const __sentinel& y)
+		{ return x.last_ == y.end_; }
+		friend constexpr bool operator==(const __sentinel& x, const __iterator<Const>& y)
+		{ return y == x; }
+		friend constexpr bool operator!=(const __iterator<Const>& x, const __sentinel& y)
+		{ return !(x == y); }
+		friend constexpr bool operator!=(const __sentinel& x, const __iterator<Const>& y)
+		{ return !(y == x); }
+
+		friend constexpr D operator-(const __iterator<Const>& x, const __sentinel& y)
+		requires SizedSentinel<sentinel_t<Base>, iterator_t<Base>>
+		{ return x.last_ - y.end_; }
+		friend constexpr D operator-(const __sentinel& x, const __iterator<Const>& y)
+		requires SizedSentinel<sentinel_t<Base>, iterator_t<Base>>
+		{ return x.end_ - y.last_; }
+	};
+
+	template<class R>
+	sliding_view(R&&, iter_difference_t<iterator_t<R>>) -> sliding_view<all_view<R>>;
+
+	namespace view {
+		struct __sliding_fn {
+			template<ViewableRange Rng>
+			requires ForwardRange<Rng>
+			constexpr auto operator()(Rng&& rng, iter_difference_t<iterator_t<Rng>> n) const
+			{ return sliding_view{std::forward<Rng>(rng), n}; }
+
+			template<Integral D>
+			constexpr auto operator()(D n) const
+			{ return detail::view_closure{*this, static_cast<D>(n)}; }
+		};
+
+		inline constexpr __sliding_fn sliding {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
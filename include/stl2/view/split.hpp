@@ -14,7 +14,10 @@
 
 #include <stl2/type_traits.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/contiguous.hpp>
+#include <stl2/detail/algorithm/find.hpp>
 #include <stl2/detail/algorithm/mismatch.hpp>
+#include <stl2/detail/algorithm/search.hpp>
 #include <stl2/detail/concepts/object.hpp>
 #include <stl2/detail/iterator/default_sentinel.hpp>
 #include <stl2/detail/range/access.hpp>
@@ -32,6 +35,16 @@ STL2_OPEN_NAMESPACE {
 		} &&
 		std::remove_reference_t<R>::size() <= 1;
 
+	// Delimiters in a Base of contiguous bytes are found with memchr, or
+	// with the SIMD searcher for patterns of several elements.
+	template<class Base, class Pattern>
+	META_CONCEPT __split_memsearchable =
+		SizedSentinel<sentinel_t<Base>, iterator_t<Base>> &&
+		SizedSentinel<sentinel_t<Pattern>, iterator_t<Pattern>> &&
+		detail::__byte_haystack<iterator_t<Base>, iter_value_t<iterator_t<Base>>> &&
+		detail::MemComparable<iterator_t<Base>, iterator_t<Pattern>,
+			equal_to, identity, identity>;
+
 	template<InputRange Rng>
 	struct __split_view_base {
 		iterator_t<Rng> current_ {};
@@ -159,7 +172,14 @@ STL2_OPEN_NAMESPACE {
 			if (cur == end) return *this;
 			const auto [pbegin, pend] = subrange{parent_->pattern_};
 			if (pbegin == pend) ++cur;
-			else {
+			else if constexpr (__split_memsearchable<Base, Pattern>) {
+				if (__stl2::next(pbegin) == pend) {
+					cur = __stl2::find(std::move(cur), end, *pbegin);
+					if (cur != end) ++cur;
+				} else {
+					cur = __stl2::search(std::move(cur), end, pbegin, pend).end();
+				}
+			} else {
 				do {
 					const auto [b, p] = mismatch(cur, end, pbegin, pend);
 					if (p == pend) {
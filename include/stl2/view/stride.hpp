@@ -0,0 +1,271 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_STRIDE_HPP
+#define STL2_VIEW_STRIDE_HPP
+
+#include <utility>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/iterator/default_sentinel.hpp>
+#include <stl2/detail/iterator/operations.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/view/view_closure.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/view_interface.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// stride_view [Extension]
+//
+// Every n-th element of a range, starting with the first. Iterators
+// advance with bounded steps, so they never move past the end of the
+// underlying range; they remember how far short of a full step the last
+// one fell, so the view is as traversable and as sized as the underlying
+// range, and end() is O(1) for common, sized ranges.
+//
+STL2_OPEN_NAMESPACE {
+	template<View V>
+	requires InputRange<V>
+	class stride_view : public view_interface<stride_view<V>> {
+	private:
+		using D = iter_difference_t<iterator_t<V>>;
+
+		template<bool> class __iterator;
+
+		V base_ = V();
+		D stride_ = 1;
+
+		static constexpr D div_ceil(D num, D denom) {
+			D r = num / denom;
+			if (num % denom) ++r;
+			return r;
+		}
+
+		template<bool Const, class Self>
+		static constexpr auto end_(Self& self) {
+			using Base = __maybe_const<Const, V>;
+			if constexpr (CommonRange<Base> && SizedRange<Base> && ForwardRange<Base>) {
+				const auto missing = (self.stride_ - static_cast<D>(__stl2::size(self.base_))
+					% self.stride_) % self.stride_;
+				return __iterator<Const>{self, __stl2::end(self.base_), missing};
+			} else if constexpr (CommonRange<Base> && ForwardRange<Base> &&
+				!BidirectionalRange<Base>)
+			{
+				return __iterator<Const>{self, __stl2::end(self.base_)};
+			} else {
+				return default_sentinel{};
+			}
+		}
+
+	public:
+		stride_view() = default;
+		constexpr stride_view(V base, D stride)
+		: base_(std::move(base)), stride_(stride)
+		{ STL2_EXPECT(stride > 0); }
+
+		constexpr V base() const { return base_; }
+		constexpr D stride() const noexcept { return stride_; }
+
+		constexpr auto begin() requires !ext::SimpleView<V>
+		{ return __iterator<false>{*this, __stl2::begin(base_)}; }
+		constexpr auto begin() const requires Range<const V>
+		{ return __iterator<true>{*this, __stl2::begin(base_)}; }
+
+		constexpr auto end() requires !ext::SimpleView<V>
+		{ return end_<false>(*this); }
+		constexpr auto end() const requires Range<const V>
+		{ return end_<true>(*this); }
+
+		constexpr auto size() requires SizedRange<V> {
+			using S = decltype(__stl2::size(base_));
+			return static_cast<S>(div_ceil(static_cast<D>(__stl2::size(base_)), stride_));
+		}
+		constexpr auto size() const requires SizedRange<const V> {
+			using S = decltype(__stl2::size(base_));
+			return static_cast<S>(div_ceil(static_cast<D>(__stl2::size(base_)), stride_));
+		}
+	};
+
+	template<class R>
+	stride_view(R&&, iter_difference_t<iterator_t<R>>) -> stride_view<all_view<R>>;
+
+	template<View V>
+	requires InputRange<V>
+	template<bool Const>
+	class stride_view<V>::__iterator {
+	private:
+		using Parent = __maybe_const<Const, stride_view>;
+		using Base = __maybe_const<Const, V>;
+
+		iterator_t<Base> current_ {};
+		sentinel_t<Base> end_ {};
+		D stride_ = 0;
+		// How far short of a full stride the step onto end_ fell.
+		D missing_ = 0;
+		friend __iterator<!Const>;
+	public:
+		// Never contiguous: neighbouring elements are stride_ apart.
+		using iterator_category = meta::if_c<RandomAccessRange<Base>,
+			__stl2::random_access_iterator_tag, iterator_category_t<iterator_t<Base>>>;
+		using value_type = iter_value_t<iterator_t<Base>>;
+		using difference_type = D;
+
+		__iterator() = default;
+
+		constexpr __iterator(Parent& parent, iterator_t<Base> current, D missing = 0)
+		: current_(std::move(current)), end_(__stl2::end(parent.base_))
+		, stride_(parent.stride_), missing_(missing) {}
+
+		constexpr __iterator(__iterator<!Const> i)
+		requires Const && ConvertibleTo<iterator_t<V>, iterator_t<Base>> &&
+			ConvertibleTo<sentinel_t<V>, sentinel_t<Base>>
+		: current_(std::move(i.current_)), end_(std::move(i.end_))
+		, stride_(i.stride_), missing_(i.missing_) {}
+
+		constexpr iterator_t<Base> base() const
+		{ return current_; }
+		constexpr D stride() const noexcept
+		{ return stride_; }
+
+		constexpr decltype(auto) operator*() const
+		{ return *current_; }
+
+		constexpr __iterator& operator++() {
+			STL2_EXPECT(current_ != end_);
+			missing_ = __stl2::advance(current_, stride_, end_);
+			return *this;
+		}
+		constexpr void operator++(int)
+		{ ++*this; }
+		constexpr __iterator operator++(int) requires ForwardRange<Base>
+		{
+			auto tmp = *this;
+			++*this;
+			return tmp;
+		}
+
+		constexpr __iterator& operator--() requires BidirectionalRange<Base> {
+			__stl2::advance(current_, missing_ - stride_);
+			missing_ = 0;
+			return *this;
+		}
+		constexpr __iterator operator--(int) requires BidirectionalRange<Base> {
+			auto tmp = *this;
+			--*this;
+			return tmp;
+		}
+
+		constexpr __iterator& operator+=(difference_type n)
+		requires RandomAccessRange<Base>
+		{
+			if (n > 0) {
+				missing_ = __stl2::advance(current_, stride_ * n, end_);
+			} else if (n < 0) {
+				__stl2::advance(current_, stride_ * n + missing_);
+				missing_ = 0;
+			}
+			return *this;
+		}
+		constexpr __iterator& operator-=(difference_type n)
+		requires RandomAccessRange<Base>
+		{ return *this += -n; }
+		constexpr decltype(auto) operator[](difference_type n) const
+		requires RandomAccessRange<Base>
+		{ return *(*this + n); }
+
+		friend constexpr bool operator==(const __iterator& x, const __iterator& y)
+		requires EqualityComparable<iterator_t<Base>>
+		{ return x.current_ == y.current_; }
+		friend constexpr bool operator!=(const __iterator& x, const __iterator& y)
+		requires EqualityComparable<iterator_t<Base>>
+		{ return !(x == y); }
+
+		friend constexpr bool operator==(const __iterator& x, default_sentinel)
+		{ return x.current_ == x.end_; }
+		friend constexpr bool operator==(default_sentinel x, const __iterator& y)
+		{ return y == x; }
+		friend constexpr bool operator!=(const __iterator& x, default_sentinel y)
+		{ return !(x == y); }
+		friend constexpr bool operator!=(default_sentinel x, const __iterator& y)
+		{ return !(y == x); }
+
+		friend constexpr bool operator<(const __iterator& x, const __iterator& y)
+		requires RandomAccessRange<Base>
+		{ return x.current_ < y.current_; }
+		friend constexpr bool operator>(const __iterator& x, const __iterator& y)
+		requires RandomAccessRange<Base>
+		{ return y < x; }
+		friend constexpr bool operator<=(const __iterator& x, const __iterator& y)
+		requires RandomAccessRange<Base>
+		{ return !(y < x); }
+		friend constexpr bool operator>=(const __iterator& x, const __iterator& y)
+		requires RandomAccessRange<Base>
+		{ return !(x < y); }
+
+		friend constexpr __iterator operator+(__iterator i, difference_type n)
+		requires RandomAccessRange<Base>
+		{ return i += n; }
+		friend constexpr __iterator operator+(difference_type n, __iterator i)
+		requires RandomAccessRange<Base>
+		{ return i += n; }
+		friend constexpr __iterator operator-(__iterator i, difference_type n)
+		requires RandomAccessRange<Base>
+		{ return i -= n; }
+
+		friend constexpr difference_type operator-(const __iterator& x, const __iterator& y)
+		requires SizedSentinel<iterator_t<Base>, iterator_t<Base>>
+		{
+			const D n = x.current_ - y.current_;
+			if constexpr (ForwardRange<Base>) {
+				return (n + x.missing_ - y.missing_) / x.stride_;
+			} else {
+				return n < 0 ? -div_ceil(-n, x.stride_) : div_ceil(n, x.stride_);
+			}
+		}
+
+		friend constexpr difference_type operator-(default_sentinel, const __iterator& x)
+		requires SizedSentinel<sentinel_t<Base>, iterator_t<Base>>
+		{ return div_ceil(static_cast<D>(x.end_ - x.current_), x.stride_); }
+		friend constexpr difference_type operator-(const __iterator& x, default_sentinel y)
+		requires SizedSentinel<sentinel_t<Base>, iterator_t<Base>>
+		{ return -(y - x); }
+
+		friend constexpr decltype(auto) iter_move(const __iterator& i)
+		STL2_NOEXCEPT_RETURN(
+			__stl2::iter_move(i.current_)
+		)
+		friend constexpr void iter_swap(const __iterator& x, const __iterator& y)
+		noexcept(noexcept(__stl2::iter_swap(x.current_, y.current_)))
+		requires IndirectlySwappable<iterator_t<Base>>
+		{ __stl2::iter_swap(x.current_, y.current_); }
+	};
+
+	namespace view {
+		struct __stride_fn {
+			template<ViewableRange Rng>
+			requires InputRange<Rng>
+			constexpr auto operator()(Rng&& rng, iter_difference_t<iterator_t<Rng>> n) const
+			{ return stride_view{std::forward<Rng>(rng), n}; }
+
+			template<Integral D>
+			constexpr auto operator()(D n) const
+			{ return detail::view_closure{*this, static_cast<D>(n)}; }
+		};
+
+		inline constexpr __stride_fn stride {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -18,6 +18,7 @@
 #include <stl2/detail/iterator/counted_iterator.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/partition.hpp>
 #include <stl2/detail/view/view_closure.hpp>
 #include <stl2/view/all.hpp>
 #include <stl2/view/view_interface.hpp>
@@ -80,6 +81,24 @@ STL2_OPEN_NAMESPACE {
 
 		constexpr auto size() requires !ext::SimpleView<R> && SizedRange<R> { return size_(*this); }
 		constexpr auto size() const requires SizedRange<const R> { return size_(*this); }
+
+		// Extension: split the leading elements of a random-access underlying
+		// range that is sized - so the pieces stop at its end, if that comes
+		// first - or unbounded.
+		friend auto partition_range(const take_view& r, D k)
+		requires RandomAccessRange<const R> &&
+			(SizedRange<const R> || detail::__unbounded_range<const R>)
+		{
+			D n = r.count_;
+			if constexpr (SizedRange<const R>) {
+				const auto size = static_cast<D>(__stl2::size(r.base_));
+				if (size < n) n = size;
+			}
+			auto first = __stl2::begin(r.base_);
+			return detail::__partition_by_bounds(n, k, [&first](D lo, D hi) {
+				return subrange{first + lo, first + hi};
+			});
+		}
 	};
 
 	template<Range R>
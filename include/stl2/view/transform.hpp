@@ -13,6 +13,9 @@
 #define STL2_VIEW_TRANSFORM_HPP
 
 #include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
 
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/meta.hpp>
@@ -22,15 +25,69 @@
 #include <stl2/detail/functional/invoke.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/partition.hpp>
 #include <stl2/detail/view/view_closure.hpp>
 #include <stl2/view/all.hpp>
 #include <stl2/view/view_interface.hpp>
 
 STL2_OPEN_NAMESPACE {
-	template<InputRange V, CopyConstructible F>
+	namespace detail {
+		// A caching transform_view iterator remembers the result of its last
+		// dereference - by address if the function returns a reference -
+		// until it changes position. Moving the iterator moves the result
+		// along; copies start out empty so that copying stays cheap. Each
+		// dereference returns a copy of a cached prvalue, so move-only
+		// results can't be cached.
+		template<class R>
+		META_CONCEPT __transform_cacheable =
+			std::is_reference_v<R> || CopyConstructible<R>;
+
+		template<class R, bool Enable>
+		struct __transform_cache {
+			constexpr void reset() const noexcept {}
+		};
+		template<class R>
+		struct __transform_cache<R, true> {
+			using T = meta::if_c<std::is_reference_v<R>,
+				std::remove_reference_t<R>*, R>;
+			mutable std::optional<T> cache_;
+
+			__transform_cache() = default;
+			constexpr __transform_cache(const __transform_cache&) noexcept {}
+			__transform_cache(__transform_cache&&) = default;
+			constexpr __transform_cache& operator=(const __transform_cache&) noexcept {
+				reset();
+				return *this;
+			}
+			__transform_cache& operator=(__transform_cache&&) = default;
+
+			constexpr void reset() const noexcept { cache_.reset(); }
+
+			template<class Fn>
+			constexpr R get(Fn fn) const {
+				if (!cache_) {
+					if constexpr (std::is_reference_v<R>) {
+						R r = fn();
+						cache_.emplace(std::addressof(r));
+					} else {
+						cache_.emplace(fn());
+					}
+				}
+				if constexpr (std::is_reference_v<R>) {
+					return static_cast<R>(**cache_);
+				} else {
+					return *cache_;
+				}
+			}
+		};
+	}
+
+	template<InputRange V, CopyConstructible F, bool Cache = false>
 	requires View<V> && std::is_object_v<F> &&
-		RegularInvocable<F&, iter_reference_t<iterator_t<V>>>
-	class transform_view : public view_interface<transform_view<V, F>> {
+		RegularInvocable<F&, iter_reference_t<iterator_t<V>>> &&
+		(!Cache || detail::__transform_cacheable<
+			invoke_result_t<F&, iter_reference_t<iterator_t<V>>>>)
+	class transform_view : public view_interface<transform_view<V, F, Cache>> {
 	private:
 		template<bool> class __iterator;
 		template<bool> class __sentinel;
@@ -52,7 +109,9 @@ STL2_OPEN_NAMESPACE {
 		// Template to work around https://gcc.gnu.org/bugzilla/show_bug.cgi?id=82507
 		template<class ConstV = const V>
 		constexpr __iterator<true> begin() const requires Range<ConstV> &&
-			RegularInvocable<const F&, iter_reference_t<iterator_t<ConstV>>>
+			RegularInvocable<const F&, iter_reference_t<iterator_t<ConstV>>> &&
+			(!Cache || detail::__transform_cacheable<
+				invoke_result_t<const F&, iter_reference_t<iterator_t<ConstV>>>>)
 		{ return {*this, __stl2::begin(base_)}; }
 
 		constexpr auto end() {
@@ -66,7 +125,9 @@ STL2_OPEN_NAMESPACE {
 		// Template to work around https://gcc.gnu.org/bugzilla/show_bug.cgi?id=82507
 		template<class ConstV = const V>
 		constexpr auto end() const requires Range<ConstV> &&
-			RegularInvocable<const F&, iter_reference_t<iterator_t<ConstV>>>
+			RegularInvocable<const F&, iter_reference_t<iterator_t<ConstV>>> &&
+			(!Cache || detail::__transform_cacheable<
+				invoke_result_t<const F&, iter_reference_t<iterator_t<ConstV>>>>)
 		{
 			if constexpr (CommonRange<const V>) {
 				return __iterator<true>{*this, __stl2::end(base_)};
@@ -80,18 +141,42 @@ STL2_OPEN_NAMESPACE {
 
 		constexpr auto size() const requires SizedRange<const V>
 		{ return __stl2::size(base_); }
+
+		// Extension: split the underlying range, and transform each piece.
+		friend auto partition_range(const transform_view& r,
+			iter_difference_t<iterator_t<V>> k)
+		requires ext::PartitionableRange<const V&>
+		{
+			return detail::__adapt_partition(ext::partition_range(r.base_, k),
+				[&r](auto&& piece) {
+					return transform_view<ext::partition_piece_t<const V&>, F, Cache>{
+						std::move(piece), r.fun_.get()};
+				});
+		}
 	};
 
 	template<class R, class F>
 	transform_view(R&& r, F fun) -> transform_view<all_view<R>, F>;
 
-	template<InputRange V, CopyConstructible F>
-	requires View<V> && Invocable<F&, iter_reference_t<iterator_t<V>>>
+	namespace ext {
+		template<class V, class F>
+		using cached_transform_view = transform_view<V, F, true>;
+	}
+
+	template<InputRange V, CopyConstructible F, bool Cache>
+	requires View<V> && std::is_object_v<F> &&
+		RegularInvocable<F&, iter_reference_t<iterator_t<V>>> &&
+		(!Cache || detail::__transform_cacheable<
+			invoke_result_t<F&, iter_reference_t<iterator_t<V>>>>)
 	template<bool Const>
-	class transform_view<V, F>::__iterator {
+	class transform_view<V, F, Cache>::__iterator
+	: private detail::__transform_cache<invoke_result_t<__maybe_const<Const, F>&,
+		iter_reference_t<iterator_t<__maybe_const<Const, V>>>>, Cache> {
 	private:
 		using Parent = __maybe_const<Const, transform_view>;
 		using Base = __maybe_const<Const, V>;
+		using cache_t = detail::__transform_cache<invoke_result_t<__maybe_const<Const, F>&,
+			iter_reference_t<iterator_t<Base>>>, Cache>;
 		iterator_t<Base> current_ {};
 		Parent* parent_ = nullptr;
 		friend __iterator<!Const>;
@@ -113,16 +198,24 @@ STL2_OPEN_NAMESPACE {
 
 		constexpr iterator_t<Base> base() const
 		{ return current_; }
-		constexpr decltype(auto) operator*() const
-		{ return invoke(parent_->fun_.get(), *current_); }
+		constexpr decltype(auto) operator*() const {
+			if constexpr (Cache) {
+				return cache_t::get([this]() -> decltype(auto) {
+					return invoke(parent_->fun_.get(), *current_);
+				});
+			} else {
+				return invoke(parent_->fun_.get(), *current_);
+			}
+		}
 
 		constexpr __iterator& operator++()
 		{
+			cache_t::reset();
 			++current_;
 			return *this;
 		}
 		constexpr void operator++(int)
-		{ ++current_; }
+		{ ++*this; }
 		constexpr __iterator operator++(int) requires ForwardRange<Base>
 		{
 			auto tmp = *this;
@@ -132,6 +225,7 @@ STL2_OPEN_NAMESPACE {
 
 		constexpr __iterator& operator--() requires BidirectionalRange<Base>
 		{
+			cache_t::reset();
 			--current_;
 			return *this;
 		}
@@ -145,12 +239,14 @@ STL2_OPEN_NAMESPACE {
 		constexpr __iterator& operator+=(difference_type n)
 		requires RandomAccessRange<Base>
 		{
+			cache_t::reset();
 			current_ += n;
 			return *this;
 		}
 		constexpr __iterator& operator-=(difference_type n)
 		requires RandomAccessRange<Base>
 		{
+			cache_t::reset();
 			current_ -= n;
 			return *this;
 		}
@@ -212,10 +308,13 @@ STL2_OPEN_NAMESPACE {
 		{ __stl2::iter_swap(x.current_, y.current_); }
 	};
 
-	template<InputRange V, CopyConstructible F>
-	requires View<V> && Invocable<F&, iter_reference_t<iterator_t<V>>>
+	template<InputRange V, CopyConstructible F, bool Cache>
+	requires View<V> && std::is_object_v<F> &&
+		RegularInvocable<F&, iter_reference_t<iterator_t<V>>> &&
+		(!Cache || detail::__transform_cacheable<
+			invoke_result_t<F&, iter_reference_t<iterator_t<V>>>>)
 	template<bool Const>
-	class transform_view<V, F>::__sentinel {
+	class transform_view<V, F, Cache>::__sentinel {
 	private:
 		using Parent = __maybe_const<Const, transform_view>;
 		using Base = __maybe_const<Const, V>;
@@ -271,6 +370,32 @@ STL2_OPEN_NAMESPACE {
 		};
 
 		inline constexpr __transform_fn transform {};
+
+		namespace ext {
+			// Extension: like view::transform, but each iterator remembers
+			// the result of its last dereference, so that fun is invoked
+			// once per position visited rather than once per dereference.
+			// Results that can't be cached - move-only prvalues - fall back
+			// to an uncached transform_view.
+			struct __cached_transform_fn {
+				template<InputRange Rng, CopyConstructible F>
+				requires ViewableRange<Rng> &&
+					Invocable<F&, iter_reference_t<iterator_t<Rng>>>
+				constexpr auto operator()(Rng&& rng, F fun) const {
+					constexpr bool cache = detail::__transform_cacheable<
+						invoke_result_t<F&, iter_reference_t<iterator_t<Rng>>>>;
+					return transform_view<all_view<Rng>, F, cache>{
+						view::all(std::forward<Rng>(rng)), std::move(fun)};
+				}
+
+				template<CopyConstructible F>
+				constexpr auto operator()(F fun) const {
+					return detail::view_closure{*this, std::move(fun)};
+				}
+			};
+
+			inline constexpr __cached_transform_fn cached_transform {};
+		}
 	} // namespace view
 } STL2_CLOSE_NAMESPACE
 
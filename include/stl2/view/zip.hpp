@@ -0,0 +1,407 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_ZIP_HPP
+#define STL2_VIEW_ZIP_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/common_tuple.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/functional/invoke.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/transform.hpp>
+#include <stl2/view/view_interface.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// zip_view [Extension]
+//
+// The tuples of corresponding elements of several ranges, as long as the
+// shortest of them. The reference type is a common_tuple of the ranges'
+// references, so algorithms that permute elements - sort, rotate, and
+// the like - permute all of the ranges in step without copying their
+// elements into tuples.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template<class... Rs>
+		META_CONCEPT __zip_is_common =
+			((RandomAccessRange<Rs> && ...) && (SizedRange<Rs> && ...)) ||
+			((CommonRange<Rs> && ...) &&
+				(sizeof...(Rs) == 1 || !(BidirectionalRange<Rs> && ...)));
+
+		template<class T, class U, std::size_t... Is>
+		constexpr bool __zip_any_equal(const T& t, const U& u,
+			std::index_sequence<Is...>)
+		{ return (bool(std::get<Is>(t) == std::get<Is>(u)) || ...); }
+
+		// The difference between corresponding elements of t and u that is
+		// least in magnitude.
+		template<class D, class T, class U, std::size_t... Is>
+		constexpr D __zip_distance(const T& t, const U& u,
+			std::index_sequence<0, Is...>)
+		{
+			D d = static_cast<D>(std::get<0>(t) - std::get<0>(u));
+			const auto closer = [&d](D e) {
+				if ((e < 0 ? -e : e) < (d < 0 ? -d : d)) d = e;
+			};
+			(closer(static_cast<D>(std::get<Is>(t) - std::get<Is>(u))), ...);
+			return d;
+		}
+	}
+
+	template<InputRange... Vs>
+	requires (sizeof...(Vs) > 0) && (View<Vs> && ...)
+	class zip_view : public view_interface<zip_view<Vs...>> {
+	private:
+		template<bool> class __iterator;
+		template<bool> class __sentinel;
+
+		std::tuple<Vs...> bases_ = std::tuple<Vs...>();
+
+		template<bool Const, class Self>
+		static constexpr auto end_(Self& self) {
+			if constexpr ((RandomAccessRange<__maybe_const<Const, Vs>> && ...) &&
+				(SizedRange<__maybe_const<Const, Vs>> && ...))
+			{
+				using D = iter_difference_t<__iterator<Const>>;
+				return self.begin() + static_cast<D>(self.size());
+			} else if constexpr (detail::__zip_is_common<__maybe_const<Const, Vs>...>) {
+				return std::apply([](auto&... bases) {
+					return __iterator<Const>{__stl2::end(bases)...};
+				}, self.bases_);
+			} else {
+				return std::apply([](auto&... bases) {
+					return __sentinel<Const>{__stl2::end(bases)...};
+				}, self.bases_);
+			}
+		}
+
+		template<class Self>
+		static constexpr auto size_(Self& self) {
+			return std::apply([](auto&... bases) {
+				using T = common_type_t<decltype(__stl2::size(bases))...>;
+				const T sizes[] = {static_cast<T>(__stl2::size(bases))...};
+				T n = sizes[0];
+				for (T s : sizes) {
+					if (s < n) n = s;
+				}
+				return n;
+			}, self.bases_);
+		}
+
+	public:
+		zip_view() = default;
+
+		constexpr explicit zip_view(Vs... bases)
+		: bases_(std::move(bases)...) {}
+
+		constexpr __iterator<false> begin() {
+			return std::apply([](auto&... bases) {
+				return __iterator<false>{__stl2::begin(bases)...};
+			}, bases_);
+		}
+
+		// Template to work around https://gcc.gnu.org/bugzilla/show_bug.cgi?id=82507
+		template<bool Const = true>
+		constexpr __iterator<true> begin() const
+		requires (Range<__maybe_const<Const, Vs>> && ...)
+		{
+			return std::apply([](auto&... bases) {
+				return __iterator<true>{__stl2::begin(bases)...};
+			}, bases_);
+		}
+
+		constexpr auto end() { return end_<false>(*this); }
+
+		// Template to work around https://gcc.gnu.org/bugzilla/show_bug.cgi?id=82507
+		template<bool Const = true>
+		constexpr auto end() const requires (Range<__maybe_const<Const, Vs>> && ...)
+		{ return end_<true>(*this); }
+
+		constexpr auto size() requires (SizedRange<Vs> && ...)
+		{ return size_(*this); }
+
+		constexpr auto size() const requires (SizedRange<const Vs> && ...)
+		{ return size_(*this); }
+	};
+
+	template<class... Rs>
+	zip_view(Rs&&...) -> zip_view<all_view<Rs>...>;
+
+	template<InputRange... Vs>
+	requires (sizeof...(Vs) > 0) && (View<Vs> && ...)
+	template<bool Const>
+	class zip_view<Vs...>::__iterator {
+	private:
+		template<class V>
+		using Base = __maybe_const<Const, V>;
+
+		std::tuple<iterator_t<Base<Vs>>...> current_ {};
+		friend __iterator<!Const>;
+		friend __sentinel<Const>;
+
+		static constexpr auto indices = std::index_sequence_for<Vs...>{};
+		static constexpr bool forward = (ForwardRange<Base<Vs>> && ...);
+		static constexpr bool bidi = (BidirectionalRange<Base<Vs>> && ...);
+		static constexpr bool random_access = (RandomAccessRange<Base<Vs>> && ...);
+
+		template<class T, class U, std::size_t... Is>
+		static constexpr void swap_(const T& t, const U& u, std::index_sequence<Is...>)
+		{ (__stl2::iter_swap(std::get<Is>(t), std::get<Is>(u)), ...); }
+	public:
+		using iterator_category = std::conditional_t<
+			random_access, __stl2::random_access_iterator_tag,
+			std::conditional_t<bidi, __stl2::bidirectional_iterator_tag,
+			std::conditional_t<forward,
+				__stl2::forward_iterator_tag, __stl2::input_iterator_tag>>>;
+		using value_type = std::tuple<iter_value_t<iterator_t<Base<Vs>>>...>;
+		using difference_type = common_type_t<iter_difference_t<iterator_t<Base<Vs>>>...>;
+
+		__iterator() = default;
+
+		constexpr explicit __iterator(iterator_t<Base<Vs>>... current)
+		: current_(std::move(current)...) {}
+
+		constexpr __iterator(__iterator<!Const> i)
+		requires Const && (ConvertibleTo<iterator_t<Vs>, iterator_t<Base<Vs>>> && ...)
+		: current_(std::move(i.current_)) {}
+
+		constexpr auto operator*() const {
+			return std::apply([](const auto&... is) {
+				return ext::common_tuple<iter_reference_t<iterator_t<Base<Vs>>>...>{*is...};
+			}, current_);
+		}
+
+		constexpr __iterator& operator++() {
+			std::apply([](auto&... is) { (++is, ...); }, current_);
+			return *this;
+		}
+		constexpr void operator++(int)
+		{ ++*this; }
+		constexpr __iterator operator++(int) requires forward
+		{
+			auto tmp = *this;
+			++*this;
+			return tmp;
+		}
+
+		constexpr __iterator& operator--() requires bidi
+		{
+			std::apply([](auto&... is) { (--is, ...); }, current_);
+			return *this;
+		}
+		constexpr __iterator operator--(int) requires bidi
+		{
+			auto tmp = *this;
+			--*this;
+			return tmp;
+		}
+
+		constexpr __iterator& operator+=(difference_type n)
+		requires random_access
+		{
+			std::apply([n](auto&... is) {
+				((void)(is += static_cast<iter_difference_t<__uncvref<decltype(is)>>>(n)), ...);
+			}, current_);
+			return *this;
+		}
+		constexpr __iterator& operator-=(difference_type n)
+		requires random_access
+		{ return *this += -n; }
+		constexpr auto operator[](difference_type n) const
+		requires random_access
+		{ return *(*this + n); }
+
+		// Iterators over ranges that can't decrement might reach the end
+		// of the shortest range only.
+		friend constexpr bool operator==(const __iterator& x, const __iterator& y)
+		requires (EqualityComparable<iterator_t<Base<Vs>>> && ...)
+		{
+			if constexpr (bidi) {
+				return x.current_ == y.current_;
+			} else {
+				return detail::__zip_any_equal(x.current_, y.current_, indices);
+			}
+		}
+
+		friend constexpr bool operator!=(const __iterator& x, const __iterator& y)
+		requires (EqualityComparable<iterator_t<Base<Vs>>> && ...)
+		{ return !(x == y); }
+
+		friend constexpr bool operator<(const __iterator& x, const __iterator& y)
+		requires random_access
+		{ return x.current_ < y.current_; }
+
+		friend constexpr bool operator>(const __iterator& x, const __iterator& y)
+		requires random_access
+		{ return y < x; }
+
+		friend constexpr bool operator<=(const __iterator& x, const __iterator& y)
+		requires random_access
+		{ return !(y < x); }
+
+		friend constexpr bool operator>=(const __iterator& x, const __iterator& y)
+		requires random_access
+		{ return !(x < y); }
+
+		friend constexpr __iterator operator+(__iterator i, difference_type n)
+		requires random_access
+		{ return i += n; }
+
+		friend constexpr __iterator operator+(difference_type n, __iterator i)
+		requires random_access
+		{ return i += n; }
+
+		friend constexpr __iterator operator-(__iterator i, difference_type n)
+		requires random_access
+		{ return i -= n; }
+
+		friend constexpr difference_type operator-(const __iterator& x, const __iterator& y)
+		requires (SizedSentinel<iterator_t<Base<Vs>>, iterator_t<Base<Vs>>> && ...)
+		{ return detail::__zip_distance<difference_type>(x.current_, y.current_, indices); }
+
+		friend constexpr auto iter_move(const __iterator& i)
+		noexcept((noexcept(__stl2::iter_move(std::declval<const iterator_t<Base<Vs>>&>())) && ...))
+		{
+			return std::apply([](const auto&... is) {
+				return ext::common_tuple<iter_rvalue_reference_t<iterator_t<Base<Vs>>>...>{
+					__stl2::iter_move(is)...};
+			}, i.current_);
+		}
+
+		friend constexpr void iter_swap(const __iterator& x, const __iterator& y)
+		noexcept((noexcept(__stl2::iter_swap(std::declval<const iterator_t<Base<Vs>>&>(),
+			std::declval<const iterator_t<Base<Vs>>&>())) && ...))
+		requires (IndirectlySwappable<iterator_t<Base<Vs>>> && ...)
+		{ swap_(x.current_, y.current_, indices); }
+	};
+
+	template<InputRange... Vs>
+	requires (sizeof...(Vs) > 0) && (View<Vs> && ...)
+	template<bool Const>
+	class zip_view<Vs...>::__sentinel {
+	private:
+		template<class V>
+		using Base = __maybe_const<Const, V>;
+
+		std::tuple<sentinel_t<Base<Vs>>...> end_ {};
+		friend __sentinel<!Const>;
+
+		static constexpr auto indices = std::index_sequence_for<Vs...>{};
+	public:
+		__sentinel() = default;
+		constexpr explicit __sentinel(sentinel_t<Base<Vs>>... end)
+		: end_(std::move(end)...) {}
+		constexpr __sentinel(__sentinel<!Const> s)
+		requires Const && (ConvertibleTo<sentinel_t<Vs>, sentinel_t<Base<Vs>>> && ...)
+		: end_(std::move(s.end_)) {}
+
+		// The end of the shortest range is the end of them all.
+		friend constexpr bool operator==(const __iterator<Const>& x, const __sentinel& y)
+		{ return detail::__zip_any_equal(x.current_, y.end_, indices); }
+
+		friend constexpr bool operator==(const __sentinel& x, const __iterator<Const>& y)
+		{ return y == x; }
+
+		friend constexpr bool operator!=(const __iterator<Const>& x, const __sentinel& y)
+		{ return !(x == y); }
+
+		friend constexpr bool operator!=(const __sentinel& x, const __iterator<Const>& y)
+		{ return !(y == x); }
+
+		friend constexpr iter_difference_t<__iterator<Const>>
+		operator-(const __iterator<Const>& x, const __sentinel& y)
+		requires (SizedSentinel<sentinel_t<Base<Vs>>, iterator_t<Base<Vs>>> && ...)
+		{
+			return detail::__zip_distance<iter_difference_t<__iterator<Const>>>(
+				x.current_, y.end_, indices);
+		}
+
+		friend constexpr iter_difference_t<__iterator<Const>>
+		operator-(const __sentinel& x, const __iterator<Const>& y)
+		requires (SizedSentinel<sentinel_t<Base<Vs>>, iterator_t<Base<Vs>>> && ...)
+		{ return -(y - x); }
+	};
+
+	namespace detail {
+		// Calls F with the elements of a zip_view's tuple, for zip_with.
+		template<CopyConstructible F>
+		struct __zip_with_apply {
+			F fun_;
+
+			template<class T, std::size_t... Is>
+			static constexpr auto apply_(F& f, T&& t, std::index_sequence<Is...>)
+			-> decltype(__stl2::invoke(f, std::get<Is>(static_cast<T&&>(t))...))
+			{ return __stl2::invoke(f, std::get<Is>(static_cast<T&&>(t))...); }
+
+			template<class T, std::size_t... Is>
+			static constexpr auto apply_(const F& f, T&& t, std::index_sequence<Is...>)
+			-> decltype(__stl2::invoke(f, std::get<Is>(static_cast<T&&>(t))...))
+			{ return __stl2::invoke(f, std::get<Is>(static_cast<T&&>(t))...); }
+
+			template<class T>
+			constexpr auto operator()(T&& t)
+			-> decltype(apply_(fun_, static_cast<T&&>(t),
+				std::make_index_sequence<std::tuple_size<__uncvref<T>>::value>{}))
+			{
+				return apply_(fun_, static_cast<T&&>(t),
+					std::make_index_sequence<std::tuple_size<__uncvref<T>>::value>{});
+			}
+
+			template<class T>
+			constexpr auto operator()(T&& t) const
+			-> decltype(apply_(fun_, static_cast<T&&>(t),
+				std::make_index_sequence<std::tuple_size<__uncvref<T>>::value>{}))
+			{
+				return apply_(fun_, static_cast<T&&>(t),
+					std::make_index_sequence<std::tuple_size<__uncvref<T>>::value>{});
+			}
+		};
+	}
+
+	namespace view {
+		struct __zip_fn {
+			template<InputRange... Rngs>
+			requires (sizeof...(Rngs) > 0) && (ViewableRange<Rngs> && ...)
+			constexpr auto operator()(Rngs&&... rngs) const {
+				return zip_view<all_view<Rngs>...>{view::all(std::forward<Rngs>(rngs))...};
+			}
+		};
+
+		inline constexpr __zip_fn zip {};
+
+		// view::zip_with(f, rngs...) is view::transform over view::zip(rngs...)
+		// that calls f with the elements of each tuple.
+		struct __zip_with_fn {
+			template<CopyConstructible F, InputRange... Rngs>
+			requires (sizeof...(Rngs) > 0) && (ViewableRange<Rngs> && ...) &&
+				std::is_object_v<F> && Invocable<F&, iter_reference_t<iterator_t<Rngs>>...>
+			constexpr auto operator()(F fun, Rngs&&... rngs) const {
+				using Z = zip_view<all_view<Rngs>...>;
+				using A = detail::__zip_with_apply<F>;
+				return transform_view<Z, A>{
+					Z{view::all(std::forward<Rngs>(rngs))...}, A{std::move(fun)}};
+			}
+		};
+
+		inline constexpr __zip_with_fn zip_with {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -15,6 +15,8 @@
 #include <stl2/utility.hpp>
 #include <algorithm>
 #include <cstring>
+#include <sstream>
+#include <string>
 #include "../simple_test.hpp"
 
 namespace ranges = __stl2;
@@ -59,6 +61,124 @@ STL2_OPEN_NAMESPACE {
 	};
 } STL2_CLOSE_NAMESPACE
 
+constexpr bool test_constexpr() {
+	int source[] = {0, 1, 2, 3, 4};
+	int target[5] = {};
+	auto res = ranges::copy(source, target);
+	return res.in == source + 5 && res.out == target + 5 &&
+		target[0] == 0 && target[4] == 4;
+}
+static_assert(test_constexpr());
+
+void test_contiguous() {
+	// Exercise the memmove fast path, including through iterator adaptors.
+	int source[64];
+	for (int i = 0; i < 64; ++i) source[i] = i;
+
+	{
+		int target[64] = {};
+		auto res = ranges::copy(source, target);
+		CHECK(res.in == source + 64);
+		CHECK(res.out == target + 64);
+		CHECK(std::equal(source, source + 64, target));
+	}
+	{
+		int target[64] = {};
+		auto res = ranges::copy(ranges::make_move_iterator(source + 0),
+			ranges::make_move_sentinel(source + 64), target);
+		CHECK(res.in.base() == source + 64);
+		CHECK(res.out == target + 64);
+		CHECK(std::equal(source, source + 64, target));
+	}
+	{
+		int target[64] = {};
+		auto res = ranges::copy(ranges::counted_iterator{source + 0, 40},
+			ranges::default_sentinel{}, ranges::counted_iterator{target + 0, 64});
+		CHECK(res.in.base() == source + 40);
+		CHECK(res.in.count() == 0);
+		CHECK(res.out.base() == target + 40);
+		CHECK(res.out.count() == 24);
+		CHECK(std::equal(source, source + 40, target));
+		CHECK(target[40] == 0);
+	}
+	{
+		int target[64] = {};
+		auto res = ranges::copy(ranges::make_reverse_iterator(source + 64),
+			ranges::make_reverse_iterator(source + 0),
+			ranges::make_reverse_iterator(target + 64));
+		CHECK(res.in.base() == source + 0);
+		CHECK(res.out.base() == target + 0);
+		CHECK(std::equal(source, source + 64, target));
+	}
+	{
+		// Reversing copies can't be a memmove.
+		int target[64] = {};
+		ranges::copy(ranges::make_reverse_iterator(source + 64),
+			ranges::make_reverse_iterator(source + 0), target);
+		CHECK(std::equal(source, source + 64, std::make_reverse_iterator(target + 64)));
+	}
+	{
+		int target[64] = {};
+		auto res = ranges::ext::copy(source + 0, source + 64, target + 0, target + 10);
+		CHECK(res.in == source + 10);
+		CHECK(res.out == target + 10);
+		CHECK(std::equal(source, source + 10, target));
+		CHECK(target[10] == 0);
+	}
+	{
+		// Overlapping, copying to the left.
+		int buf[64];
+		std::copy(source, source + 64, buf);
+		auto res = ranges::copy(buf + 8, buf + 64, buf + 0);
+		CHECK(res.out == buf + 56);
+		CHECK(std::equal(source + 8, source + 64, buf));
+	}
+}
+
+// Accepts at most limit characters.
+struct limited_buf : std::streambuf {
+	std::string data_;
+	std::size_t limit_;
+
+	explicit limited_buf(std::size_t limit) : limit_(limit) {}
+
+	int_type overflow(int_type c) override {
+		if (traits_type::eq_int_type(c, traits_type::eof())) return traits_type::not_eof(c);
+		if (data_.size() == limit_) return traits_type::eof();
+		data_.push_back(traits_type::to_char_type(c));
+		return c;
+	}
+};
+
+void test_streambuf() {
+	// Arrays of characters go to an ostreambuf_iterator with one sputn.
+	using O = ranges::ostreambuf_iterator<char>;
+	const std::string s = "The quick brown fox";
+	{
+		std::ostringstream os;
+		auto res = ranges::copy(s, O{os});
+		CHECK(res.in == s.end());
+		CHECK(res.out.rdbuf() == os.rdbuf());
+		CHECK(os.str() == s);
+	}
+	{
+		limited_buf buf{4};
+		auto res = ranges::copy(s.begin(), s.end(), O{&buf});
+		CHECK(res.in == s.end());
+		CHECK(res.out == ranges::default_sentinel{});
+		CHECK(buf.data_ == "The ");
+	}
+	{
+		// ...and so do the buffered characters of an input stream.
+		std::istringstream is{s};
+		std::ostringstream os;
+		auto res = ranges::copy(ranges::istreambuf_iterator<char>{is},
+			ranges::default_sentinel{}, O{os});
+		CHECK(res.in == ranges::default_sentinel{});
+		CHECK(os.str() == s);
+	}
+}
+
 int main() {
 	using ranges::begin;
 	using ranges::end;
@@ -112,5 +232,8 @@ int main() {
 		CHECK_EQUAL(target, {0,1,2,3,4,5,6,0});
 	}
 
+	test_contiguous();
+	test_streambuf();
+
 	return test_result();
 }
@@ -54,6 +54,35 @@ namespace {
 		auto l2 = {1, 2, 3, 4};
 		CHECK_EQUAL(ranges::subrange(target + 4, target + 8), std::move(l2));
 	}
+
+	void test_contiguous() {
+		int source[64];
+		for (int i = 0; i < 64; ++i) source[i] = i;
+		{
+			int target[64] = {};
+			auto result = ranges::copy_backward(source, target + 64);
+			CHECK(result.in == source + 64);
+			CHECK(result.out == target + 0);
+			CHECK(std::equal(source, source + 64, target));
+		}
+		{
+			int target[64] = {};
+			auto result = ranges::copy_backward(ranges::make_reverse_iterator(source + 64),
+				ranges::make_reverse_iterator(source + 0),
+				ranges::make_reverse_iterator(target + 0));
+			CHECK(result.in.base() == source + 0);
+			CHECK(result.out.base() == target + 64);
+			CHECK(std::equal(source, source + 64, target));
+		}
+		{
+			// Overlapping, copying to the right.
+			int buf[64];
+			std::copy(source, source + 64, buf);
+			auto result = ranges::copy_backward(buf + 0, buf + 56, buf + 64);
+			CHECK(result.out == buf + 8);
+			CHECK(std::equal(source, source + 56, buf + 8));
+		}
+	}
 }
 
 int main() {
@@ -85,6 +114,7 @@ int main() {
 
 	test_repeat_view();
 	test_initializer_list();
+	test_contiguous();
 
 	return test_result();
 }
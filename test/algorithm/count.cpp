@@ -10,6 +10,8 @@
 // Project home: https://github.com/ericniebler/range-v3
 
 #include <stl2/detail/algorithm/count.hpp>
+#include <cstdint>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -18,6 +20,33 @@ struct S
 	int i;
 };
 
+template<class T>
+void test_contiguous()
+{
+	// Lengths straddle the vector widths, and the largest one overflows the
+	// per-byte counters of the vectorized loop.
+	for (int n : {0, 1, 15, 16, 17, 33, 100, 10000}) {
+		std::vector<T> v(n);
+		int expected = 0;
+		for (int i = 0; i < n; ++i) {
+			v[i] = static_cast<T>(i % 7);
+			expected += i % 7 == 3;
+		}
+		CHECK(__stl2::count(v, T(3)) == expected);
+		CHECK(__stl2::count(v.data(), v.data() + n, T(3)) == expected);
+		CHECK(__stl2::count(__stl2::counted_iterator{v.begin(), n},
+			__stl2::default_sentinel{}, T(3)) == expected);
+		CHECK(__stl2::count(v, T(42)) == 0);
+	}
+}
+
+constexpr bool test_constexpr()
+{
+	int a[] = {0, 1, 2, 2, 3};
+	return __stl2::count(a, 2) == 2;
+}
+static_assert(test_constexpr());
+
 int main()
 {
 	using namespace __stl2;
@@ -65,5 +94,18 @@ int main()
 		CHECK(count(std::move(l), 7) == 0);
 	}
 
+	test_contiguous<char>();
+	test_contiguous<std::uint8_t>();
+	test_contiguous<std::int16_t>();
+	test_contiguous<std::uint32_t>();
+	test_contiguous<std::int64_t>();
+
+	{
+		// Values that no element can equal.
+		unsigned char uc[] = {0, 255, 255};
+		CHECK(count(uc, -1) == 0);
+		CHECK(count(uc, 255) == 2);
+	}
+
 	return ::test_result();
 }
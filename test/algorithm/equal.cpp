@@ -19,6 +19,9 @@
 //===----------------------------------------------------------------------===//
 
 #include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/iterator.hpp>
+#include <cstdint>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -32,6 +35,39 @@ bool counting_equals(const T &a, const T &b) {
 	return a == b;
 }
 
+template<class T>
+void test_contiguous() {
+	// Flip every position of ranges whose lengths straddle the vector widths.
+	for (int n : {0, 1, 15, 16, 17, 33, 100}) {
+		std::vector<T> a(n), b(n);
+		for (int i = 0; i < n; ++i) a[i] = b[i] = static_cast<T>(i % 7);
+		CHECK(ranges::equal(a, b));
+		CHECK(ranges::equal(a.data(), a.data() + n, b.data(), b.data() + n));
+		CHECK(ranges::equal(
+			ranges::make_reverse_iterator(a.end()), ranges::make_reverse_iterator(a.begin()),
+			ranges::make_reverse_iterator(b.end()), ranges::make_reverse_iterator(b.begin())));
+		for (int i = 0; i < n; ++i) {
+			b[i] = static_cast<T>(42);
+			CHECK(!ranges::equal(a, b));
+			CHECK(!ranges::equal(
+				ranges::make_reverse_iterator(a.end()), ranges::make_reverse_iterator(a.begin()),
+				ranges::make_reverse_iterator(b.end()), ranges::make_reverse_iterator(b.begin())));
+			b[i] = a[i];
+		}
+		if (n > 0) {
+			CHECK(!ranges::equal(a.begin(), a.end(), b.begin(), b.end() - 1));
+		}
+	}
+}
+
+constexpr bool test_constexpr() {
+	int a[] = {0, 1, 2, 3};
+	int b[] = {0, 1, 2, 3};
+	int c[] = {0, 1, 5, 3};
+	return ranges::equal(a, b) && !ranges::equal(a, c);
+}
+static_assert(test_constexpr());
+
 int main() {
 	using namespace ranges;
 
@@ -70,5 +106,11 @@ int main() {
 	test_case(false, 0,     R(ia), R(ia + s), R(ia), R(ia + s - 1));
 	test_case(false, s - 1, R(ia), S(ia + s), R(ia), S(ia + s - 1));
 
+	test_contiguous<char>();
+	test_contiguous<std::uint8_t>();
+	test_contiguous<std::int16_t>();
+	test_contiguous<std::uint32_t>();
+	test_contiguous<std::int64_t>();
+
 	return ::test_result();
 }
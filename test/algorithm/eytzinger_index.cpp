@@ -0,0 +1,66 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/eytzinger_index.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include <stl2/view/iota.hpp>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+int main() {
+	using ranges::ext::eytzinger_index;
+
+	for (int n = 0; n < 70; ++n) {
+		// Sorted, with runs of equal elements.
+		std::vector<std::uint64_t> v;
+		for (int i = 0; i < n; ++i) v.push_back(static_cast<std::uint64_t>(2 * (i / 3)));
+		eytzinger_index index{v};
+		static_assert(ranges::Same<decltype(index), eytzinger_index<std::uint64_t>>);
+		CHECK(index.size() == n);
+		CHECK(index.empty() == (n == 0));
+		for (std::uint64_t x = 0; x < static_cast<std::uint64_t>(n) + 2; ++x) {
+			CHECK(index.lower_bound(x) == std::lower_bound(v.begin(), v.end(), x) - v.begin());
+			CHECK(index.upper_bound(x) == std::upper_bound(v.begin(), v.end(), x) - v.begin());
+			CHECK(index.contains(x) == std::binary_search(v.begin(), v.end(), x));
+		}
+	}
+
+	{
+		// A comparison and a projection, over elements that are not scalars.
+		std::vector<std::pair<int, std::string>> v{{9, "i"}, {7, "g"}, {7, "gg"},
+			{4, "d"}, {1, "a"}};
+		eytzinger_index index{v, ranges::greater{}, &std::pair<int, std::string>::first};
+		CHECK(index.lower_bound(7) == 1);
+		CHECK(index.upper_bound(7) == 3);
+		CHECK(v[static_cast<std::size_t>(index.lower_bound(5))].second == "d");
+		CHECK(index.lower_bound(0) == 5);
+		CHECK(index.upper_bound(10) == 0);
+		CHECK(index.contains(4));
+		CHECK(!index.contains(5));
+	}
+
+	{
+		// Any sorted random-access range will do.
+		eytzinger_index index{ranges::view::iota(10, 1010)};
+		CHECK(index.lower_bound(500) == 490);
+		CHECK(index.upper_bound(500) == 491);
+		CHECK(index.lower_bound(5000) == 1000);
+		CHECK(!index.contains(9));
+	}
+
+	return ::test_result();
+}
@@ -19,6 +19,8 @@
 //===----------------------------------------------------------------------===//
 
 #include <stl2/detail/algorithm/fill.hpp>
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <string>
 #include <vector>
@@ -73,6 +75,26 @@ void test_int() {
 	CHECK(ia[3] == 2);
 }
 
+template<class T>
+void test_contiguous(const T value) {
+	// Odd sizes exercise the scalar tail of the vectorized fill.
+	for (std::size_t n : {0, 1, 7, 31, 67, 1000}) {
+		std::vector<T> v(n + 2, T{});
+		auto res = ranges::fill(v.begin() + 1, v.end() - 1, value);
+		CHECK(res == v.end() - 1);
+		CHECK(v.front() == T{});
+		CHECK(v.back() == T{});
+		CHECK(std::count(v.begin() + 1, v.end() - 1, value) == static_cast<std::ptrdiff_t>(n));
+	}
+}
+
+constexpr bool test_constexpr() {
+	int a[4] = {};
+	ranges::fill(a, 42);
+	return a[0] == 42 && a[3] == 42;
+}
+static_assert(test_constexpr());
+
 int main() {
 	test_char<forward_iterator<char*> >();
 	test_char<bidirectional_iterator<char*> >();
@@ -92,5 +114,20 @@ int main() {
 	test_int<bidirectional_iterator<int*>, sentinel<int*> >();
 	test_int<random_access_iterator<int*>, sentinel<int*> >();
 
+	test_contiguous<char>('x');
+	test_contiguous<std::int16_t>(0x0102);
+	test_contiguous<int>(0);
+	test_contiguous<int>(0x01020304);
+	test_contiguous<std::uint64_t>(0xdeadbeefcafef00d);
+	test_contiguous<double>(-1.5);
+
+	{
+		// Arithmetic conversions and reverse iterators
+		double d[5] = {};
+		ranges::fill(ranges::make_reverse_iterator(d + 5), ranges::make_reverse_iterator(d + 1), 3);
+		CHECK(d[0] == 0.0);
+		CHECK(std::count(d + 1, d + 5, 3.0) == 4);
+	}
+
 	return ::test_result();
 }
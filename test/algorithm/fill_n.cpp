@@ -19,6 +19,8 @@
 //===----------------------------------------------------------------------===//
 
 #include <stl2/detail/algorithm/fill_n.hpp>
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <string>
 #include <vector>
@@ -104,5 +106,16 @@ int main() {
 	test_int<bidirectional_iterator<int*>, sentinel<int*> >();
 	test_int<random_access_iterator<int*>, sentinel<int*> >();
 
+	{
+		std::vector<std::uint32_t> v(103, 0);
+		auto res = ranges::fill_n(v.begin() + 1, 101, 0x01020304u);
+		CHECK(res == v.end() - 1);
+		CHECK(v.front() == 0u);
+		CHECK(v.back() == 0u);
+		CHECK(std::count(v.begin(), v.end(), 0x01020304u) == 101);
+		CHECK(ranges::fill_n(v.begin(), -1, 42u) == v.begin());
+		CHECK(v.front() == 0u);
+	}
+
 	return ::test_result();
 }
@@ -20,6 +20,8 @@
 
 #include <stl2/detail/algorithm/find.hpp>
 #include <stl2/utility.hpp>
+#include <cstdint>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -29,6 +31,35 @@ struct S {
 	int i_;
 };
 
+template<class T>
+void test_contiguous() {
+	// Place the needle at every position of ranges whose lengths straddle
+	// the vector widths to exercise both the vector loop and the tail.
+	for (int n : {0, 1, 15, 16, 17, 33, 100}) {
+		std::vector<T> v(n);
+		for (int i = 0; i < n; ++i) v[i] = static_cast<T>(i % 7);
+		for (int i = 0; i < n; ++i) {
+			const T saved = v[i];
+			v[i] = static_cast<T>(42);
+			CHECK(ranges::find(v, T(42)) == v.begin() + i);
+			CHECK(ranges::find(v.data(), v.data() + n, T(42)) == v.data() + i);
+			v[i] = saved;
+		}
+		CHECK(ranges::find(v, T(42)) == v.end());
+		if (n > 0) {
+			auto res = ranges::find(ranges::counted_iterator{v.begin(), n},
+				ranges::default_sentinel{}, v.back());
+			CHECK(res.base() == ranges::find(v, v.back()));
+		}
+	}
+}
+
+constexpr bool test_constexpr() {
+	int a[] = {0, 1, 2, 3};
+	return ranges::find(a, 2) == a + 2;
+}
+static_assert(test_constexpr());
+
 int main() {
 	using namespace ranges;
 
@@ -59,5 +90,22 @@ int main() {
 	ps = find(sa, 10, &S::i_);
 	CHECK(ps == end(sa));
 
+	test_contiguous<char>();
+	test_contiguous<std::uint8_t>();
+	test_contiguous<std::int16_t>();
+	test_contiguous<std::uint32_t>();
+	test_contiguous<std::int64_t>();
+
+	{
+		// Values that no element can equal.
+		unsigned char uc[] = {0, 255, 1};
+		CHECK(find(uc, -1) == end(uc));
+		CHECK(find(uc, 256) == end(uc));
+		CHECK(find(uc, 255) == uc + 1);
+		int si[] = {5, -1, 7};
+		CHECK(find(si, std::int64_t{0xffffffff}) == end(si));
+		CHECK(find(si, std::int64_t{-1}) == si + 1);
+	}
+
 	return ::test_result();
 }
@@ -15,6 +15,10 @@
 
 #include <stl2/detail/algorithm/lower_bound.hpp>
 #include <stl2/view/iota.hpp>
+#include <stl2/view/take.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <list>
 #include <vector>
 #include <utility>
 #include "../simple_test.hpp"
@@ -35,6 +39,57 @@ void not_totally_ordered() {
 	ranges::lower_bound(vec, my_int{10}, compare);
 }
 
+void test_branchless() {
+	// Scalar elements take the branchless, prefetching bisection.
+	static_assert(ranges::detail::__branchless_bisectable<std::uint64_t*, ranges::identity>);
+	static_assert(!ranges::detail::__branchless_bisectable<std::pair<int, int>*,
+		ranges::identity>);
+	for (int n = 0; n < 40; ++n) {
+		std::vector<std::uint64_t> v;
+		for (int i = 0; i < n; ++i) v.push_back(static_cast<std::uint64_t>(2 * (i / 3)));
+		for (std::uint64_t x = 0; x < static_cast<std::uint64_t>(n) + 2; ++x) {
+			CHECK(ranges::lower_bound(v, x) == std::lower_bound(v.begin(), v.end(), x));
+			CHECK(ranges::ext::lower_bound_n(v.begin(), n, x, ranges::greater{},
+				[n](std::uint64_t y) { return n - y; }) ==
+				std::lower_bound(v.begin(), v.end(), x, [n](std::uint64_t y, std::uint64_t z) {
+					return n - y > z;
+				}));
+		}
+	}
+}
+
+void test_lower_bound_many() {
+	std::vector<int> haystack;
+	for (int i = 0; i < 1000; ++i) haystack.push_back(i / 2 * 3);
+	std::vector<int> needles;
+	for (int i = -5; i < 1600; i += 7) needles.push_back(i);
+	std::reverse(needles.begin(), needles.end());
+
+	std::vector<std::vector<int>::iterator> result(needles.size() + 1);
+	auto [in, out] = ranges::ext::lower_bound_many(haystack, needles, result.begin());
+	CHECK(in == needles.end());
+	CHECK(out == result.end() - 1);
+	for (std::size_t i = 0; i < needles.size(); ++i) {
+		CHECK(result[i] == std::lower_bound(haystack.begin(), haystack.end(), needles[i]));
+	}
+
+	// Needles from any forward range, and a projection of the haystack.
+	std::pair<int, int> a[] = {{0, 0}, {0, 1}, {1, 2}, {1, 3}, {3, 4}, {3, 5}};
+	std::list<int> keys{3, 0, 2, 4};
+	std::pair<int, int>* pos[4] = {};
+	ranges::ext::lower_bound_many(a, keys, pos, ranges::less{}, &std::pair<int, int>::first);
+	CHECK(pos[0] == a + 4);
+	CHECK(pos[1] == a + 0);
+	CHECK(pos[2] == a + 4);
+	CHECK(pos[3] == a + 6);
+
+	std::vector<int> empty;
+	std::vector<int>::iterator e[2];
+	ranges::ext::lower_bound_many(empty, keys | ranges::view::take(2), e);
+	CHECK(e[0] == empty.end());
+	CHECK(e[1] == empty.end());
+}
+
 int main() {
 	using ranges::begin;
 	using ranges::end;
@@ -66,5 +121,8 @@ int main() {
 
 	CHECK(*ranges::lower_bound(ranges::iota_view<int>{}, 42) == 42);
 
+	test_branchless();
+	test_lower_bound_many();
+
 	return test_result();
 }
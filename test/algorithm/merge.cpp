@@ -82,5 +82,16 @@ int main() {
 		CHECK(std::is_sorted(ic.get(), ic.get() + 2 * N));
 	}
 
+	{
+		// Stability: equivalent elements come from the first range first.
+		using P = std::pair<int, int>;
+		P a[] = {{0, 0}, {1, 0}, {1, 1}, {2, 0}};
+		P b[] = {{1, 2}, {2, 1}, {3, 0}};
+		P c[7];
+		ranges::merge(a, b, c, ranges::less{}, &P::first, &P::first);
+		const P expected[] = {{0, 0}, {1, 0}, {1, 1}, {1, 2}, {2, 0}, {2, 1}, {3, 0}};
+		CHECK(std::equal(c, c + 7, expected));
+	}
+
 	return ::test_result();
 }
@@ -23,6 +23,9 @@
 #include <numeric>
 #include <random>
 #include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -167,6 +170,41 @@ void test_iter_comp() {
 	}
 }
 
+// Contiguous ranges of arithmetic values ordered by less or greater take a
+// vectorized path, which must pick the same elements among equal ones as
+// the element-at-a-time loop - and fall back to it when there is a NaN.
+template<class T>
+void test_vectorized() {
+	std::uniform_int_distribution<int> dist(-8, 8);
+	for (unsigned n : {1u, 2u, 7u, 8u, 15u, 16u, 17u, 31u, 33u, 64u, 100u, 1000u, 4099u}) {
+		std::vector<T> v(n);
+		for (auto& x : v) x = static_cast<T>(dist(gen));
+		if constexpr (std::is_floating_point_v<T>) {
+			v[n / 2] = T(-0.0);
+			if (n > 3) v[n / 3] = T(0.0);
+		}
+		auto const check = [&] {
+			using F = forward_iterator<const T*>;
+			const T* const p = v.data();
+			auto r = ranges::minmax_element(p, p + n);
+			auto s = ranges::minmax_element(F(p), F(p + n));
+			CHECK(r.min == s.min.base());
+			CHECK(r.max == s.max.base());
+			r = ranges::minmax_element(p, p + n, ranges::greater{});
+			s = ranges::minmax_element(F(p), F(p + n), ranges::greater{});
+			CHECK(r.min == s.min.base());
+			CHECK(r.max == s.max.base());
+		};
+		check();
+#if !defined(__FINITE_MATH_ONLY__) || !__FINITE_MATH_ONLY__
+		if constexpr (std::is_floating_point_v<T>) {
+			v[n - 1] = std::numeric_limits<T>::quiet_NaN();
+			check();
+		}
+#endif
+	}
+}
+
 struct S {
 	int i;
 };
@@ -188,6 +226,11 @@ int main() {
 	test_iter<bidirectional_iterator<const int*>, sentinel<const int*>>();
 	test_iter<random_access_iterator<const int*>, sentinel<const int*>>();
 
+	test_vectorized<int>();
+	test_vectorized<unsigned>();
+	test_vectorized<float>();
+	test_vectorized<double>();
+
 	// Works with projections?
 	S s[] = {S{1},S{2},S{3},S{4},S{-4},S{5},S{6},S{40},S{7},S{8},S{9}};
 	ranges::minmax_result<S const *> ps =
@@ -19,8 +19,10 @@
 //===----------------------------------------------------------------------===//
 
 #include <stl2/detail/algorithm/mismatch.hpp>
+#include <cstdint>
 #include <memory>
 #include <algorithm>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -70,6 +72,36 @@ struct S {
 	int i;
 };
 
+template<class T>
+void test_contiguous() {
+	// Flip every position of ranges whose lengths straddle the vector widths.
+	for (int n : {0, 1, 15, 16, 17, 33, 100}) {
+		std::vector<T> a(n), b(n + 1);
+		for (int i = 0; i < n; ++i) a[i] = b[i] = static_cast<T>(i % 7);
+		auto res = ranges::mismatch(a, b);
+		CHECK(res.in1 == a.end());
+		CHECK(res.in2 == b.begin() + n);
+		for (int i = 0; i < n; ++i) {
+			b[i] = static_cast<T>(42);
+			res = ranges::mismatch(a, b);
+			CHECK(res.in1 == a.begin() + i);
+			CHECK(res.in2 == b.begin() + i);
+			auto pres = ranges::mismatch(b.data(), b.data() + n, a.data(), a.data() + n);
+			CHECK(pres.in1 == b.data() + i);
+			CHECK(pres.in2 == a.data() + i);
+			b[i] = a[i];
+		}
+	}
+}
+
+constexpr bool test_constexpr() {
+	int a[] = {0, 1, 2, 3};
+	int b[] = {0, 1, 5, 3};
+	auto res = ranges::mismatch(a, b);
+	return res.in1 == a + 2 && res.in2 == b + 2;
+}
+static_assert(test_constexpr());
+
 int main() {
 	test_range<input_iterator<const int*>>();
 	test_range<forward_iterator<const int*>>();
@@ -113,5 +145,11 @@ int main() {
 		CHECK(ps2.in2->i == 5);
 	}
 
+	test_contiguous<char>();
+	test_contiguous<std::uint8_t>();
+	test_contiguous<std::int16_t>();
+	test_contiguous<std::uint32_t>();
+	test_contiguous<std::int64_t>();
+
 	return test_result();
 }
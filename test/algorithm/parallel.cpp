@@ -0,0 +1,217 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/algorithm.hpp>
+#include <stl2/execution.hpp>
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	std::vector<int> random_ints(std::size_t n, int max = 1 << 30) {
+		std::uniform_int_distribution<int> dist{0, max};
+		std::vector<int> v(n);
+		for (auto& x : v) x = dist(gen);
+		return v;
+	}
+
+	template<class EP>
+	void test_policy(EP policy) {
+		constexpr std::size_t n = 200000;
+
+		{
+			std::vector<int> v(n, 1);
+			auto it = ranges::for_each(policy, v, [](int& x) { x *= 2; });
+			CHECK(it == v.end());
+			CHECK(std::all_of(v.begin(), v.end(), [](int x) { return x == 2; }));
+			std::atomic<long> sum{0};
+			ranges::for_each(policy, v.begin(), v.end(),
+				[&](int x) { sum += x; }, [](int x) { return x + 1; });
+			CHECK(sum.load() == 3L * long(n));
+		}
+
+		{
+			auto v = random_ints(n, 1000);
+			auto w = random_ints(n + 17, 1000);
+			std::vector<int> out(n), expected(n);
+			auto r = ranges::transform(policy, v, out.begin(), [](int x) { return x * 3; });
+			CHECK(r.in == v.end());
+			CHECK(r.out == out.end());
+			std::transform(v.begin(), v.end(), expected.begin(), [](int x) { return x * 3; });
+			CHECK(out == expected);
+
+			auto r2 = ranges::transform(policy, v, w, out.begin(), std::plus<>{});
+			CHECK(r2.in1 == v.end());
+			CHECK(r2.in2 == w.begin() + n);
+			CHECK(r2.out == out.end());
+			std::transform(v.begin(), v.end(), w.begin(), expected.begin(), std::plus<>{});
+			CHECK(out == expected);
+		}
+
+		{
+			auto v = random_ints(n, 99);
+			const auto odd = [](int x) { return x % 2 != 0; };
+			CHECK(ranges::count_if(policy, v, odd) == std::count_if(v.begin(), v.end(), odd));
+			CHECK(ranges::count_if(policy, v.begin(), v.begin(), odd) == 0);
+		}
+
+		{
+			std::vector<int> v(n, 0);
+			const auto is_one = [](int x) { return x == 1; };
+			CHECK(ranges::find_if(policy, v, is_one) == v.end());
+			CHECK(!ranges::any_of(policy, v, is_one));
+			CHECK(ranges::none_of(policy, v, is_one));
+			CHECK(!ranges::all_of(policy, v, is_one));
+			// The first match wins, wherever the later ones are.
+			for (std::size_t i : {n - 1, n / 2, n / 3, std::size_t{5000}, std::size_t{0}}) {
+				v[i] = 1;
+				CHECK((ranges::find_if(policy, v, is_one) - v.begin()) == std::ptrdiff_t(i));
+				CHECK(ranges::any_of(policy, v, is_one));
+				CHECK(!ranges::none_of(policy, v, is_one));
+			}
+			ranges::fill(policy, v, 1);
+			CHECK(ranges::all_of(policy, v, is_one));
+			CHECK(ranges::all_of(policy, v.begin(), v.end(), [](int x) { return x == 2; },
+				[](int x) { return x * 2; }));
+		}
+
+		{
+			std::vector<std::string> v(n / 10);
+			auto it = ranges::fill(policy, v.begin(), v.end(), std::string("fill"));
+			CHECK(it == v.end());
+			CHECK(std::all_of(v.begin(), v.end(), [](auto& s) { return s == "fill"; }));
+			std::vector<std::string> w(v.size() + 1);
+			auto r = ranges::copy(policy, v, w.begin());
+			CHECK(r.in == v.end());
+			CHECK(r.out == w.end() - 1);
+			CHECK(std::equal(v.begin(), v.end(), w.begin()));
+			CHECK(w.back().empty());
+
+			auto x = random_ints(n);
+			std::vector<int> y(n);
+			ranges::copy(policy, x.begin(), x.end(), y.begin());
+			CHECK(x == y);
+		}
+
+		{
+			for (std::size_t size : {std::size_t{0}, std::size_t{100}, n, 5 * n}) {
+				auto v = random_ints(size);
+				auto expected = v;
+				std::sort(expected.begin(), expected.end());
+				CHECK(ranges::sort(policy, v) == v.end());
+				CHECK(v == expected);
+				// Sorted input, and many duplicates.
+				ranges::sort(policy, v);
+				CHECK(v == expected);
+				v = random_ints(size, 3);
+				ranges::sort(policy, v.begin(), v.end(), ranges::greater{});
+				CHECK(std::is_sorted(v.begin(), v.end(), std::greater<>{}));
+			}
+			std::vector<std::pair<int, std::string>> v;
+			for (int i : random_ints(n / 4)) v.emplace_back(i, std::to_string(i));
+			ranges::sort(policy, v, ranges::less{}, &std::pair<int, std::string>::first);
+			CHECK(std::is_sorted(v.begin(), v.end()));
+			CHECK(std::all_of(v.begin(), v.end(),
+				[](auto& p) { return p.second == std::to_string(p.first); }));
+		}
+
+		{
+			std::vector<std::pair<int, int>> v;
+			auto keys = random_ints(n, 100);
+			for (std::size_t i = 0; i < n; ++i) v.emplace_back(keys[i], int(i));
+			auto expected = v;
+			std::stable_sort(expected.begin(), expected.end(),
+				[](auto& x, auto& y) { return x.first < y.first; });
+			CHECK(ranges::stable_sort(policy, v, ranges::less{},
+				&std::pair<int, int>::first) == v.end());
+			CHECK(v == expected);
+
+			// Sizes that split into uneven runs, and reused scratch space.
+			ranges::ext::scratch_buffer scratch;
+			for (std::size_t size : {std::size_t{0}, std::size_t{300}, std::size_t{40000},
+				n + 1, 3 * n - 1})
+			{
+				v.clear();
+				keys = random_ints(size, 10);
+				for (std::size_t i = 0; i < size; ++i) v.emplace_back(keys[i], int(i));
+				expected = v;
+				std::stable_sort(expected.begin(), expected.end(),
+					[](auto& x, auto& y) { return x.first > y.first; });
+				CHECK(ranges::stable_sort(policy, v.begin(), v.end(), scratch,
+					ranges::greater{}, &std::pair<int, int>::first) == v.end());
+				CHECK(v == expected);
+			}
+			CHECK(scratch.capacity() >= (3 * n - 1) * sizeof(v[0]));
+
+			std::vector<std::string> s;
+			for (int i : random_ints(n, 1000)) s.push_back(std::to_string(i));
+			auto t = s;
+			std::stable_sort(t.begin(), t.end());
+			CHECK(ranges::stable_sort(policy, s, scratch) == s.end());
+			CHECK(s == t);
+		}
+	}
+}
+
+int main() {
+	ranges::ext::thread_pool pool{3};
+	test_policy(ranges::ext::seq);
+	test_policy(ranges::ext::par);
+	test_policy(ranges::ext::par_unseq);
+	test_policy(ranges::ext::par.on(pool));
+	test_policy(ranges::ext::par_unseq.on(pool));
+
+	static_assert(ranges::ext::ExecutionPolicy<const ranges::ext::parallel_policy&>);
+	static_assert(!ranges::ext::ExecutionPolicy<int>);
+
+	{
+		// Rvalue ranges dangle.
+		auto r = ranges::sort(ranges::ext::par, std::vector<int>{3, 1, 2});
+		static_assert(ranges::Same<decltype(r), ranges::dangling>);
+	}
+
+	{
+		// An exception thrown on any thread reaches the caller.
+		std::vector<int> v(100000);
+		std::iota(v.begin(), v.end(), 0);
+		bool caught = false;
+		try {
+			ranges::for_each(ranges::ext::par.on(pool), v, [](int x) {
+				if (x == 77777) throw std::runtime_error{"77777"};
+			});
+		} catch (std::runtime_error& e) {
+			caught = e.what() == std::string("77777");
+		}
+		CHECK(caught);
+	}
+
+	{
+		// Tasks that wait on tasks of the same pool.
+		std::vector<std::vector<int>> vs(8);
+		for (auto& v : vs) v = random_ints(50000);
+		ranges::for_each(ranges::ext::par.on(pool), vs.begin(), vs.end(),
+			[&](std::vector<int>& v) { ranges::sort(ranges::ext::par.on(pool), v); });
+		CHECK(std::all_of(vs.begin(), vs.end(),
+			[](auto& v) { return std::is_sorted(v.begin(), v.end()); }));
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,182 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/radix_sort.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace { std::mt19937 gen; }
+
+template<class T>
+std::vector<T> random_keys(std::size_t n) {
+	std::vector<T> v(n);
+	if constexpr (std::is_floating_point_v<T>) {
+		std::uniform_real_distribution<T> dist{-1e6, 1e6};
+		for (auto& x : v) x = dist(gen);
+	} else {
+		std::uniform_int_distribution<std::int64_t> dist{
+			static_cast<std::int64_t>(std::numeric_limits<T>::min()),
+			static_cast<std::int64_t>(std::numeric_limits<T>::max() >> 1)};
+		for (auto& x : v) x = static_cast<T>(static_cast<T>(dist(gen)) * (std::is_signed_v<T> ? 1 : 2));
+	}
+	return v;
+}
+
+template<class T>
+void test_keys() {
+	// Sizes below and above the comparison sort cutoff.
+	for (std::size_t n : {0u, 1u, 2u, 63u, 64u, 65u, 1000u, 100000u}) {
+		auto v = random_keys<T>(n);
+		auto expected = v;
+		std::sort(expected.begin(), expected.end());
+		auto w = v;
+		CHECK(ranges::ext::radix_sort(w) == w.end());
+		CHECK(w == expected);
+		w = v;
+		CHECK(ranges::ext::stable_radix_sort(w.begin(), w.end()) == w.end());
+		CHECK(w == expected);
+	}
+}
+
+struct record {
+	std::uint32_t key;
+	int order;
+	std::string payload;
+};
+
+int main() {
+	test_keys<std::uint8_t>();
+	test_keys<std::int8_t>();
+	test_keys<std::int16_t>();
+	test_keys<std::uint32_t>();
+	test_keys<std::int32_t>();
+	test_keys<std::uint64_t>();
+	test_keys<std::int64_t>();
+	test_keys<float>();
+	test_keys<double>();
+
+	{
+		// Signs, zeros and infinities.
+		const double inf = std::numeric_limits<double>::infinity();
+		std::vector<double> v;
+		for (int i = 0; i < 100; ++i) {
+			v.insert(v.end(), {-inf, inf, 0.0, -1.5, 1.5, -1e-300, 1e300,
+				std::numeric_limits<double>::denorm_min(), -2.0});
+		}
+		std::shuffle(v.begin(), v.end(), gen);
+		auto expected = v;
+		std::sort(expected.begin(), expected.end());
+		ranges::ext::radix_sort(v);
+		CHECK(v == expected);
+	}
+
+	{
+		// -0.0 and +0.0 are equivalent: the stable sort keeps their order.
+		// Read and write the sign bits directly: with -ffast-math the
+		// compiler needn't tell -0.0 from +0.0.
+		const auto sign = [](const double& d) {
+			std::uint64_t u;
+			std::memcpy(&u, &d, sizeof(u));
+			return u >> 63;
+		};
+		std::vector<double> v(200);
+		const std::uint64_t negative_zero = std::uint64_t{1} << 63;
+		for (int i = 1; i < 200; i += 2) std::memcpy(&v[i], &negative_zero, sizeof(double));
+		ranges::ext::stable_radix_sort(v);
+		for (int i = 0; i < 200; ++i) CHECK(sign(v[i]) == std::uint64_t(i % 2));
+	}
+
+	{
+		// Projected keys, stability, and non-trivial payloads.
+		std::vector<record> v;
+		std::uniform_int_distribution<std::uint32_t> dist{0, 99};
+		for (int i = 0; i < 10000; ++i) {
+			v.push_back({dist(gen), i, std::to_string(i)});
+		}
+		auto w = v;
+		CHECK(ranges::ext::stable_radix_sort(w, &record::key) == w.end());
+		for (std::size_t i = 1; i < w.size(); ++i) {
+			CHECK((w[i - 1].key < w[i].key ||
+				(w[i - 1].key == w[i].key && w[i - 1].order < w[i].order)));
+		}
+		for (auto& r : w) CHECK(r.payload == std::to_string(r.order));
+		w = v;
+		ranges::ext::radix_sort(w, &record::key);
+		CHECK(std::is_sorted(w.begin(), w.end(),
+			[](const record& x, const record& y) { return x.key < y.key; }));
+		for (auto& r : w) CHECK(r.payload == std::to_string(r.order));
+	}
+
+	{
+		// Inputs too large for cache are split into buckets by their highest
+		// varying byte, and split again if the buckets are still too large;
+		// the result must still be stable.
+		struct wide { std::uint64_t key; int order; };
+		std::vector<wide> v;
+		std::uniform_int_distribution<std::uint64_t> top{0, 3}, low{0, 99};
+		for (int i = 0; i < 300000; ++i) {
+			v.push_back({top(gen) << 56 | low(gen) << 24 | low(gen), i});
+		}
+		ranges::ext::stable_radix_sort(v, &wide::key);
+		bool ok = true;
+		for (std::size_t i = 1; i < v.size(); ++i) {
+			ok = ok && (v[i - 1].key < v[i].key ||
+				(v[i - 1].key == v[i].key && v[i - 1].order < v[i].order));
+		}
+		CHECK(ok);
+	}
+
+	{
+		// Move-only elements.
+		std::vector<std::unique_ptr<std::int64_t>> v;
+		auto keys = random_keys<std::int64_t>(100000);
+		for (auto k : keys) v.push_back(std::make_unique<std::int64_t>(k));
+		ranges::ext::radix_sort(v, [](const auto& p) { return *p; });
+		std::sort(keys.begin(), keys.end());
+		bool ok = true;
+		for (std::size_t i = 0; i < keys.size(); ++i) ok = ok && *v[i] == keys[i];
+		CHECK(ok);
+	}
+
+	{
+		// The in-place MSD strategy, used when there's no room for LSD's
+		// scratch space.
+		auto v = random_keys<std::int64_t>(100000);
+		auto w = v;
+		ranges::identity proj;
+		ranges::detail::rdxsort::msd(v.begin(), std::ptrdiff_t(v.size()), 7, proj);
+		std::sort(w.begin(), w.end());
+		CHECK(v == w);
+		v = random_keys<std::int64_t>(100000);
+		for (auto& x : v) x &= 0xfff;
+		w = v;
+		ranges::detail::rdxsort::msd(v.begin(), std::ptrdiff_t(v.size()), 7, proj);
+		std::sort(w.begin(), w.end());
+		CHECK(v == w);
+	}
+
+	{
+		// Rvalue ranges dangle.
+		auto r = ranges::ext::radix_sort(std::vector<int>{3, 1, 2});
+		static_assert(ranges::Same<decltype(r), ranges::dangling>);
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,144 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/searchers.hpp>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include <stl2/iterator.hpp>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+// The naive matcher, with no fast paths.
+template<class T>
+std::ptrdiff_t naive(const std::vector<T>& h, const std::vector<T>& p) {
+	const auto n = static_cast<std::ptrdiff_t>(h.size());
+	const auto m = static_cast<std::ptrdiff_t>(p.size());
+	for (std::ptrdiff_t i = 0; i + m <= n; ++i) {
+		std::ptrdiff_t j = 0;
+		while (j < m && h[i + j] == p[j]) ++j;
+		if (j == m) return i;
+	}
+	return n;
+}
+
+template<class T, class Searcher>
+void check(const std::vector<T>& h, const std::vector<T>& p, const Searcher& searcher) {
+	const auto expected = naive(h, p);
+	auto r = ranges::search(h, searcher);
+	CHECK((r.begin() - h.begin()) == expected);
+	CHECK((r.end() - h.begin()) ==
+		(expected == static_cast<std::ptrdiff_t>(h.size()) ? expected
+			: expected + static_cast<std::ptrdiff_t>(p.size())));
+}
+
+// Small alphabets make for repetitive input with many partial matches.
+template<class T>
+void test_random(int alphabet) {
+	std::mt19937 gen{static_cast<std::mt19937::result_type>(alphabet)};
+	std::uniform_int_distribution<int> dist{0, alphabet - 1};
+	for (int n : {0, 1, 5, 31, 32, 33, 100, 1000}) {
+		std::vector<T> h(n);
+		for (auto& x : h) x = static_cast<T>(dist(gen));
+		for (int m : {0, 1, 2, 3, 7, 17, 40}) {
+			for (int trial = 0; trial < 4; ++trial) {
+				std::vector<T> p(m);
+				if (trial % 2 == 0 && m <= n) {
+					// A pattern that is sure to occur.
+					const int pos = n == m ? 0 : static_cast<int>(gen() % (n - m + 1));
+					for (int i = 0; i < m; ++i) p[i] = h[pos + i];
+				} else {
+					for (auto& x : p) x = static_cast<T>(dist(gen));
+				}
+				check(h, p, ranges::ext::boyer_moore_horspool_searcher{p.begin(), p.end()});
+				check(h, p, ranges::ext::two_way_searcher{p.begin(), p.end()});
+				if constexpr (sizeof(T) == 1) {
+					check(h, p, ranges::ext::byte_searcher{p.begin(), p.end()});
+					// search itself takes the byte fast path here.
+					auto r = ranges::search(h, p);
+					CHECK((r.begin() - h.begin()) == naive(h, p));
+				}
+			}
+		}
+	}
+}
+
+int main() {
+	test_random<char>(2);
+	test_random<char>(4);
+	test_random<std::uint8_t>(256);
+	test_random<int>(2);
+	test_random<int>(3);
+	test_random<std::int64_t>(1000);
+
+	{
+		// Periodic patterns on periodic input: quadratic for the naive matcher.
+		std::vector<char> h(5000, 'a');
+		h.back() = 'b';
+		std::vector<char> p(100, 'a');
+		p.back() = 'b';
+		check(h, p, ranges::ext::two_way_searcher{p.begin(), p.end()});
+		check(h, p, ranges::ext::boyer_moore_horspool_searcher{p.begin(), p.end()});
+		check(h, p, ranges::ext::byte_searcher{p.begin(), p.end()});
+		std::vector<char> q{'a', 'b', 'a', 'b', 'a', 'c'};
+		std::vector<char> g{'a', 'b', 'a', 'b', 'a', 'b', 'a', 'b', 'a', 'c', 'x'};
+		check(g, q, ranges::ext::two_way_searcher{q.begin(), q.end()});
+	}
+
+	{
+		// One prepared pattern, many haystacks.
+		const std::string needle = "needle";
+		const ranges::ext::boyer_moore_horspool_searcher bmh{needle.begin(), needle.end()};
+		const ranges::ext::two_way_searcher tw{needle.begin(), needle.end()};
+		const ranges::ext::byte_searcher bs{needle.begin(), needle.end()};
+		for (std::string hay : {"", "needl", "needle", "a needle in a haystack",
+				"haystack without one", "needleneedle"}) {
+			const auto expected = hay.find(needle);
+			const auto pos = expected == std::string::npos ? hay.size() : expected;
+			CHECK(static_cast<std::size_t>(ranges::search(hay, bmh).begin() - hay.begin()) == pos);
+			CHECK(static_cast<std::size_t>(ranges::search(hay, tw).begin() - hay.begin()) == pos);
+			CHECK(static_cast<std::size_t>(ranges::search(hay, bs).begin() - hay.begin()) == pos);
+			auto r = ranges::search(hay.begin(), hay.end(), bmh);
+			CHECK(static_cast<std::size_t>(r.begin() - hay.begin()) == pos);
+		}
+	}
+
+	{
+		// Custom predicates and orders.
+		const std::string hay = "The Quick Brown Fox";
+		const std::string needle = "QUICK";
+		auto eq = [](char a, char b) { return (a | 0x20) == (b | 0x20); };
+		auto hash = [](char c) { return std::hash<int>{}(c | 0x20); };
+		ranges::ext::boyer_moore_horspool_searcher bmh{needle.begin(), needle.end(), hash, eq};
+		CHECK(ranges::search(hay, bmh).begin() == hay.begin() + 4);
+		auto lt = [](char a, char b) { return (a | 0x20) < (b | 0x20); };
+		ranges::ext::two_way_searcher tw{needle.begin(), needle.end(), lt};
+		CHECK(ranges::search(hay, tw).begin() == hay.begin() + 4);
+	}
+
+	{
+		// byte_searcher sees through counted_iterator.
+		const std::string hay = "abcabcabd";
+		const std::string needle = "abd";
+		ranges::ext::byte_searcher bs{needle.begin(), needle.end()};
+		auto r = ranges::search(ranges::counted_iterator{hay.begin(), 9},
+			ranges::default_sentinel{}, bs);
+		CHECK(r.begin().count() == 3);
+		CHECK(r.end().count() == 0);
+		r = ranges::search(ranges::counted_iterator{hay.begin(), 8},
+			ranges::default_sentinel{}, bs);
+		CHECK(r.begin().count() == 0);
+	}
+
+	return ::test_result();
+}
@@ -22,6 +22,8 @@
 #include <stl2/detail/algorithm/copy.hpp>
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <random>
 #include <vector>
@@ -180,6 +182,55 @@ test_larger_sorts(unsigned N)
 	test_larger_sorts(N, N);
 }
 
+// Inputs that exercise pdqsort's pattern detection, equal-element
+// partitioning, and branchless partitioning of arithmetic keys.
+template<class T>
+void
+test_patterns(int N)
+{
+	std::vector<T> v(N);
+	auto check = [&](auto... comp) {
+		std::vector<T> expected = v;
+		std::sort(expected.begin(), expected.end(), comp...);
+		CHECK(ranges::sort(v, comp...) == v.end());
+		CHECK(v == expected);
+	};
+	std::uniform_int_distribution<int> dist{0, N};
+	// random
+	for (auto& x : v) x = static_cast<T>(dist(gen));
+	check();
+	// sorted, with greater
+	check(std::greater<T>{});
+	// sorted
+	check();
+	// organ pipe
+	for (int i = 0; i < N; ++i) v[i] = static_cast<T>(i < N / 2 ? i : N - i);
+	check();
+	// few distinct values
+	for (auto& x : v) x = static_cast<T>(dist(gen) % 4);
+	check();
+	// all equal
+	for (auto& x : v) x = T(7);
+	check();
+	// sorted with a few swaps
+	for (int i = 0; i < N; ++i) v[i] = static_cast<T>(i);
+	for (int i = 0; i < 5 && N > 1; ++i) std::swap(v[dist(gen) % N], v[dist(gen) % N]);
+	check();
+}
+
+constexpr bool
+test_constexpr()
+{
+	int a[40] = {};
+	for (int i = 0; i < 40; ++i) a[i] = (i * 17) % 40;
+	ranges::sort(a);
+	for (int i = 0; i < 40; ++i) {
+		if (a[i] != i) return false;
+	}
+	return true;
+}
+static_assert(test_constexpr());
+
 struct S
 {
 	int i, j;
@@ -252,6 +303,28 @@ int main()
 	test_larger_sorts(1000);
 	test_larger_sorts(1009);
 
+	for (int N : {23, 24, 25, 129, 1000, 100000}) {
+		test_patterns<int>(N);
+		test_patterns<double>(N);
+		test_patterns<std::uint8_t>(N);
+	}
+
+	// Sorted and reverse-sorted input take a linear number of comparisons.
+	{
+		std::vector<int> v(100000);
+		for (int i = 0; (std::size_t)i < v.size(); ++i) v[i] = i;
+		long comparisons = 0;
+		auto counting_less = [&](int a, int b) { ++comparisons; return a < b; };
+		ranges::sort(v, counting_less);
+		CHECK(comparisons < 3 * (long)v.size());
+		CHECK(std::is_sorted(v.begin(), v.end()));
+		std::reverse(v.begin(), v.end());
+		comparisons = 0;
+		ranges::sort(v, counting_less);
+		CHECK(comparisons < 4 * (long)v.size());
+		CHECK(std::is_sorted(v.begin(), v.end()));
+	}
+
 	// Check move-only types
 	{
 		std::vector<std::unique_ptr<int> > v(1000);
@@ -21,7 +21,13 @@
 #include <stl2/detail/algorithm/stable_sort.hpp>
 #include <cassert>
 #include <memory>
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#else
+#include <experimental/memory_resource>
+#endif
 #include <random>
+#include <string>
 #include <vector>
 #include <algorithm>
 #include "../simple_test.hpp"
@@ -187,6 +193,19 @@ int main() {
 			CHECK(*v[i] == i);
 	}
 
+	// Check types whose moved-from state differs from their value
+	{
+		std::mt19937 gen;
+		for (std::size_t n : {300u, 1000u, 5000u}) {
+			std::vector<std::string> v(n);
+			for (auto& s : v) s = std::to_string(gen() % 100) + std::string(40, 'x');
+			auto expected = v;
+			std::sort(expected.begin(), expected.end());
+			ranges::stable_sort(v);
+			CHECK(v == expected);
+		}
+	}
+
 	// Check projections
 	{
 		std::vector<S> v(1000, S{});
@@ -220,5 +239,58 @@ int main() {
 		}
 	}
 
+	// Check caller-supplied scratch space, reused across calls
+	{
+		ranges::ext::scratch_buffer scratch;
+		std::mt19937 gen;
+		for (std::size_t n : {10u, 300u, 1000u, 5000u, 1000u}) {
+			std::vector<S> v(n, S{});
+			for(int i = 0; (std::size_t)i < n; ++i)
+			{
+				v[i].i = gen() % 50;
+				v[i].j = i;
+			}
+			auto expected = v;
+			std::stable_sort(expected.begin(), expected.end(),
+				[](S x, S y) { return x.i < y.i; });
+			CHECK(ranges::stable_sort(v, scratch, std::less<int>{}, &S::i) == v.end());
+			CHECK(std::equal(v.begin(), v.end(), expected.begin(),
+				[](S x, S y) { return x.i == y.i && x.j == y.j; }));
+		}
+		CHECK(scratch.capacity() >= 5000 * sizeof(S));
+		const auto capacity = scratch.capacity();
+		std::vector<int> w(3000);
+		for (auto& x : w) x = gen() % 1000;
+		CHECK(ranges::stable_sort(w.begin(), w.end(), scratch, std::greater<int>{}) == w.end());
+		CHECK(std::is_sorted(w.begin(), w.end(), std::greater<int>{}));
+		CHECK(scratch.capacity() == capacity);
+	}
+
+	// Check scratch space from a memory resource
+	{
+#if __has_include(<memory_resource>)
+		namespace pmr = std::pmr;
+#else
+		namespace pmr = std::experimental::pmr;
+#endif
+		char arena[64 * 1024];
+		pmr::monotonic_buffer_resource resource{arena, sizeof(arena),
+			pmr::null_memory_resource()};
+		std::vector<S> v(1000, S{});
+		for(int i = 0; (std::size_t)i < v.size(); ++i)
+		{
+			v[i].i = i % 10;
+			v[i].j = i;
+		}
+		{
+			ranges::ext::temporary_resource_scope scope{&resource};
+			ranges::stable_sort(v, std::less<int>{}, &S::i);
+		}
+		CHECK(std::is_sorted(v.begin(), v.end(),
+			[](S x, S y) { return x.i < y.i || (x.i == y.i && x.j < y.j); }));
+		// The scratch space came from the arena.
+		CHECK(static_cast<char*>(resource.allocate(1)) >= arena + sizeof(S) * v.size());
+	}
+
 	return ::test_result();
 }
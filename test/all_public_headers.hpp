@@ -14,18 +14,22 @@
 
 #include <experimental/ranges/algorithm>
 #include <experimental/ranges/concepts>
+#include <experimental/ranges/execution>
 #include <experimental/ranges/functional>
 #include <experimental/ranges/iterator>
 #include <experimental/ranges/memory>
+#include <experimental/ranges/numeric>
 #include <experimental/ranges/random>
 #include <experimental/ranges/ranges>
 #include <experimental/ranges/type_traits>
 #include <experimental/ranges/utility>
 #include <stl2/algorithm.hpp>
 #include <stl2/concepts.hpp>
+#include <stl2/execution.hpp>
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/memory.hpp>
+#include <stl2/numeric.hpp>
 #include <stl2/random.hpp>
 #include <stl2/ranges.hpp>
 #include <stl2/type_traits.hpp>
@@ -1,12 +1,41 @@
 #include <stl2/detail/temporary_vector.hpp>
+#include <cstdlib>
+#include <thread>
 #include "../simple_test.hpp"
 
 namespace ranges = __stl2;
 
 using ranges::detail::temporary_buffer;
 using ranges::detail::temporary_vector;
+using ranges::detail::scratch_lease;
+using ranges::detail::scratch_or_temporary_buffer;
 
 namespace {
+	// Counts what's outstanding, and checks that deallocation matches.
+	struct counting_resource : ranges::ext::memory_resource {
+		int allocations = 0;
+		int outstanding = 0;
+		bool fail = false;
+		bool mismatch = false;
+
+		void* do_allocate(std::size_t bytes, std::size_t align) override {
+			if (fail) throw std::bad_alloc{};
+			++allocations;
+			++outstanding;
+			auto p = ::operator new(bytes, std::align_val_t{align});
+			CHECK((reinterpret_cast<std::uintptr_t>(p) & (align - 1)) == 0u);
+			return p;
+		}
+		void do_deallocate(void* p, std::size_t, std::size_t align) override {
+			mismatch = mismatch || outstanding == 0;
+			--outstanding;
+			::operator delete(p, std::align_val_t{align});
+		}
+		bool do_is_equal(const ranges::ext::memory_resource& that) const noexcept override {
+			return this == &that;
+		}
+	};
+
 	template<std::size_t Alignment>
 	void test_single_alignment() {
 		struct alignas(Alignment) foo {
@@ -33,5 +62,111 @@ namespace {
 
 int main() {
 	test_alignments<1, 2, 4, 8, 16, 32, 64, 128>();
+
+	{
+		// Scratch space is reused while it's big enough, and a
+		// temporary_buffer borrowing it doesn't free it.
+		ranges::ext::scratch_buffer scratch;
+		CHECK(scratch.capacity() == 0u);
+		int* const p = scratch.data<int>(100);
+		CHECK(p != nullptr);
+		CHECK(scratch.capacity() >= 100 * sizeof(int));
+		{
+			auto buf = scratch_or_temporary_buffer<int>(&scratch, 50);
+			CHECK(buf.data() == p);
+			CHECK(buf.size() == 50);
+		}
+		CHECK(scratch.data<int>(100) == p);
+		CHECK(scratch.data<char>(10) == reinterpret_cast<char*>(p));
+
+		struct alignas(128) big { char c; };
+		big* const q = scratch.data<big>(4);
+		void* ptr = q;
+		std::size_t size = sizeof(big);
+		CHECK(std::align(128, sizeof(big), ptr, size) == q);
+		scratch.release();
+		CHECK(scratch.capacity() == 0u);
+
+		auto buf = scratch_or_temporary_buffer<int>(nullptr, 50);
+		CHECK(buf.size() == 50);
+	}
+
+	{
+		// Only the outermost lease on a thread gets the thread's buffer.
+		scratch_lease outer;
+		CHECK(outer.get() != nullptr);
+		scratch_lease inner;
+		CHECK(inner.get() == nullptr);
+		scratch_lease unwanted{false};
+		CHECK(unwanted.get() == nullptr);
+	}
+	{
+		scratch_lease again;
+		CHECK(again.get() != nullptr);
+	}
+
+	{
+		// Temporary buffers come from the thread's resource, or else the
+		// global one, or else operator new.
+		using namespace ranges::ext;
+		counting_resource global, local;
+		CHECK(get_temporary_resource() == nullptr);
+		CHECK(set_temporary_resource(&global) == nullptr);
+		{
+			temporary_buffer<int> buf{100};
+			CHECK(buf.size() == 100);
+			CHECK(global.outstanding == 1);
+			{
+				temporary_resource_scope scope{&local};
+				CHECK(get_temporary_resource() == &local);
+				temporary_buffer<double> buf2{10};
+				CHECK(local.outstanding == 1);
+				CHECK(global.outstanding == 1);
+				// Other threads see the global resource.
+				std::thread{[&] { CHECK(get_temporary_resource() == &global); }}.join();
+			}
+			CHECK(local.outstanding == 0);
+			CHECK(get_temporary_resource() == &global);
+
+			// Over-aligned types get aligned storage from the resource.
+			struct alignas(128) big { char c; };
+			temporary_buffer<big> buf3{3};
+			CHECK(buf3.size() == 3);
+			CHECK(global.outstanding == 2);
+
+			// Not scratch space kept by the thread: the resource's
+			// memory may not outlive it.
+			scratch_lease lease;
+			CHECK(lease.get() == nullptr);
+		}
+		CHECK(global.outstanding == 0);
+		CHECK(!global.mismatch);
+
+		// A resource that's out of memory yields an empty buffer.
+		global.fail = true;
+		temporary_buffer<int> none{100};
+		CHECK(none.size() == 0);
+		CHECK(none.data() == nullptr);
+		global.fail = false;
+
+		CHECK(set_temporary_resource(nullptr) == &global);
+		{
+			temporary_buffer<int> buf{100};
+			CHECK(buf.size() == 100);
+			CHECK(global.allocations == 2);
+		}
+
+		// A scratch_buffer allocates from its own resource.
+		{
+			scratch_buffer scratch{&local};
+			CHECK(scratch.resource() == &local);
+			CHECK(scratch.data<int>(10) != nullptr);
+			CHECK(scratch.data<int>(1000) != nullptr);
+			CHECK(local.allocations == 3);
+			CHECK(local.outstanding == 1);
+		}
+		CHECK(local.outstanding == 0);
+		CHECK(!local.mismatch);
+	}
 	return ::test_result();
 }
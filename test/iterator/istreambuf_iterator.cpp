@@ -12,7 +12,11 @@
 #include <stl2/detail/iterator/istreambuf_iterator.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/type_traits.hpp>
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/find.hpp>
 #include <sstream>
+#include <string>
+#include <vector>
 #include "../simple_test.hpp"
 
 using namespace __stl2;
@@ -82,6 +86,41 @@ namespace {
 	void validate() {
 		(validate_one<Cs>(), ...);
 	}
+
+	// Reads a string through a get area of at most block characters.
+	struct small_buf : std::streambuf {
+		std::string data_;
+		std::size_t pos_ = 0, block_;
+
+		small_buf(std::string data, std::size_t block)
+		: data_(std::move(data)), block_(block) {}
+
+		int_type underflow() override {
+			if (pos_ == data_.size()) return traits_type::eof();
+			const auto n = std::min(block_, data_.size() - pos_);
+			char* const p = data_.data() + pos_;
+			setg(p, p, p + n);
+			pos_ += n;
+			return traits_type::to_int_type(*p);
+		}
+	};
+
+	// Reads a string a character at a time, without a get area.
+	struct unbuffered : std::streambuf {
+		std::string data_;
+		std::size_t pos_ = 0;
+
+		explicit unbuffered(std::string data) : data_(std::move(data)) {}
+
+		int_type underflow() override {
+			if (pos_ == data_.size()) return traits_type::eof();
+			return traits_type::to_int_type(data_[pos_]);
+		}
+		int_type uflow() override {
+			if (pos_ == data_.size()) return traits_type::eof();
+			return traits_type::to_int_type(data_[pos_++]);
+		}
+	};
 }
 
 int main() {
@@ -126,5 +165,49 @@ int main() {
 		CHECK(I{in} == I{});
 	}
 
+	{
+		// Algorithms work on the get area a buffer at a time.
+		std::string text;
+		for (int i = 0; i < 1000; ++i) text += static_cast<char>('a' + i % 26);
+		text += '!';
+
+		small_buf sb{text, 7};
+		auto i = __stl2::find(I{&sb}, default_sentinel{}, '!');
+		CHECK(i != default_sentinel{});
+		CHECK(*i == '!');
+		CHECK(i.rdbuf() == &sb);
+		CHECK(__stl2::find(i, I{}, 'z') == default_sentinel{});
+
+		small_buf sb2{text, 64};
+		std::ostringstream os;
+		auto [in, out] = __stl2::copy(I{&sb2}, I{}, ostreambuf_iterator<char>{os});
+		CHECK(in == default_sentinel{});
+		CHECK(out != default_sentinel{});
+		CHECK(os.str() == text);
+
+		small_buf sb3{text, 5};
+		std::vector<char> v(text.size());
+		CHECK(__stl2::copy(I{&sb3}, default_sentinel{}, v.data()).out == v.data() + v.size());
+		CHECK(std::string(v.begin(), v.end()) == text);
+
+		// Copying stops nowhere short of the end of the stream.
+		small_buf sb4{"abc", 2};
+		std::istream is{&sb4};
+		std::string s;
+		__stl2::copy(I{is}, I{is}, __stl2::back_inserter(s));
+		CHECK(s.empty());
+		CHECK(*I{is} == 'a');
+	}
+
+	{
+		unbuffered ub{"hello, world"};
+		auto i = __stl2::find(I{&ub}, default_sentinel{}, ',');
+		CHECK(*i == ',');
+		std::string rest;
+		__stl2::copy(i, default_sentinel{}, __stl2::back_inserter(rest));
+		CHECK(rest == ", world");
+		CHECK(__stl2::find(I{&ub}, default_sentinel{}, 'x') == I{});
+	}
+
 	return ::test_result();
 }
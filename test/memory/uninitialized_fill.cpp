@@ -40,6 +40,14 @@ namespace {
 		test(ranges::uninitialized_fill(independent, x));
 		test(ranges::uninitialized_fill_n(independent.begin(), independent.size(), x));
 		test(ranges::uninitialized_fill_n(independent.cbegin(), independent.size(), x));
+
+		// Counts that leave part of a vector store at the end.
+		for (std::ptrdiff_t n : {0, 1, 7, test_size - 3}) {
+			const auto p = ranges::uninitialized_fill_n(independent.begin(), n, x);
+			CHECK(p == independent.begin() + n);
+			CHECK(ranges::find_if(independent.begin(), p, [&x](const T& i){ return i != x; }) == p);
+			ranges::destroy(independent.begin(), p);
+		}
 	}
 
 	struct S {
@@ -90,7 +98,10 @@ namespace {
 
 int main() {
 	uninitialized_fill_test(0);
+	uninitialized_fill_test(0x01020304);
 	uninitialized_fill_test(0.0);
+	uninitialized_fill_test(1.5);
+	uninitialized_fill_test(std::int64_t{-2});
 	uninitialized_fill_test('a');
 	uninitialized_fill_test(std::vector<int>{});
 	uninitialized_fill_test(std::vector<int>(1 << 10, 0));
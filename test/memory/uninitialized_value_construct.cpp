@@ -47,6 +47,14 @@ namespace {
 		test(ranges::uninitialized_value_construct(independent));
 		test(ranges::uninitialized_value_construct_n(independent.begin(), independent.size()));
 		test(ranges::uninitialized_value_construct_n(independent.cbegin(), independent.size()));
+
+		// Counts that leave part of a vector store at the end.
+		for (std::ptrdiff_t n : {0, 1, 7, N - 3}) {
+			const auto p = ranges::uninitialized_value_construct_n(independent.begin(), n);
+			CHECK(p == independent.begin() + n);
+			CHECK(ranges::find_if(independent.begin(), p, [](const T& i){ return i != T{}; }) == p);
+			ranges::destroy(independent.begin(), p);
+		}
 	}
 
 	struct S {
@@ -0,0 +1,81 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/numeric/accumulate.hpp>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include <stl2/detail/iterator/move_iterator.hpp>
+#include <stl2/detail/iterator/reverse_iterator.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	struct S {
+		int i;
+	};
+
+	constexpr int a[] = {1, 2, 3, 4, 5};
+	static_assert(ranges::ext::accumulate(a, 0) == 15);
+	static_assert(ranges::ext::accumulate(a, 1, std::multiplies<>{}) == 120);
+}
+
+int main() {
+	using ranges::ext::accumulate;
+
+	{
+		int ia[] = {1, 2, 3, 4, 5, 6};
+		using I = input_iterator<const int*>;
+		CHECK(accumulate(I(ia), sentinel<const int*>(ia + 6), 0) == 21);
+		CHECK(accumulate(I(ia), sentinel<const int*>(ia), 10) == 10);
+		CHECK(accumulate(ia, 10L) == 31L);
+		CHECK(accumulate(ia, 1, std::multiplies<>{}) == 720);
+		CHECK(accumulate(ia, 0, std::plus<>{}, [](int i) { return i * i; }) == 91);
+	}
+
+	{
+		// The fold runs from left to right.
+		std::list<std::string> words{"a", "b", "c"};
+		CHECK(accumulate(words, std::string{">"}) == ">abc");
+		CHECK(accumulate(words, std::string{}, [](std::string s, const std::string& w) {
+			return w + s;
+		}) == "cba");
+		S s[] = {S{1}, S{2}, S{3}};
+		CHECK(accumulate(s, 0, std::minus<>{}, &S::i) == -6);
+	}
+
+	{
+		// Integer sums and products of arrays are vectorized.
+		std::uniform_int_distribution<int> dist{-1000, 1000};
+		for (std::size_t n : {0u, 1u, 3u, 16u, 17u, 63u, 64u, 65u, 1000u, 4099u}) {
+			std::vector<int> v(n);
+			for (auto& x : v) x = dist(gen);
+			CHECK(accumulate(v, 7) == std::accumulate(v.begin(), v.end(), 7));
+			CHECK(accumulate(v.rbegin(), v.rend(), 7, std::plus<int>{}) ==
+				std::accumulate(v.begin(), v.end(), 7));
+			std::vector<unsigned> u(v.begin(), v.end());
+			CHECK(accumulate(u, 3u, std::multiplies<>{}) ==
+				std::accumulate(u.begin(), u.end(), 3u, std::multiplies<>{}));
+			CHECK(accumulate(ranges::make_move_iterator(u.begin()),
+				ranges::make_move_iterator(u.end()), 0u) ==
+				std::accumulate(u.begin(), u.end(), 0u));
+		}
+	}
+
+	return ::test_result();
+}
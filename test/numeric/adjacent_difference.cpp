@@ -0,0 +1,105 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/numeric/adjacent_difference.hpp>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include <stl2/detail/iterator/reverse_iterator.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	struct S {
+		int i;
+	};
+
+	constexpr bool test_constexpr() {
+		int a[] = {1, 3, 6, 10};
+		int b[4] = {};
+		ranges::ext::adjacent_difference(a, b);
+		return b[0] == 1 && b[1] == 2 && b[2] == 3 && b[3] == 4;
+	}
+	static_assert(test_constexpr());
+
+	template<class T>
+	void test_vectorized() {
+		std::uniform_int_distribution<int> dist{-1000, 1000};
+		for (std::size_t n : {0u, 1u, 2u, 3u, 7u, 8u, 9u, 16u, 17u, 63u, 64u, 65u, 1000u}) {
+			std::vector<T> v(n), expected(n), out(n + 1, T(42));
+			for (auto& x : v) x = static_cast<T>(dist(gen)) / T(4);
+			std::adjacent_difference(v.begin(), v.end(), expected.begin());
+
+			auto res = ranges::ext::adjacent_difference(v, out.begin());
+			CHECK(res.in == v.end());
+			CHECK(res.out == out.begin() + n);
+			CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+			CHECK(out[n] == T(42));
+
+			std::adjacent_difference(v.rbegin(), v.rend(), expected.begin());
+			ranges::ext::adjacent_difference(v.rbegin(), v.rend(), out.begin(),
+				std::minus<T>{});
+			CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+
+			std::adjacent_difference(v.begin(), v.end(), expected.begin());
+			ranges::ext::adjacent_difference(v, v.begin());
+			CHECK(v == expected);
+		}
+	}
+}
+
+int main() {
+	using ranges::ext::adjacent_difference;
+
+	{
+		int ia[] = {1, 3, 6, 10, 15};
+		int ib[5] = {};
+		using I = input_iterator<const int*>;
+		auto res = adjacent_difference(I(ia), sentinel<const int*>(ia + 5),
+			output_iterator<int*>(ib));
+		CHECK(res.in == I(ia + 5));
+		CHECK(res.out.base() == ib + 5);
+		CHECK_EQUAL(ib, {1, 2, 3, 4, 5});
+
+		auto empty = adjacent_difference(I(ia), sentinel<const int*>(ia), ib);
+		CHECK(empty.out == ib);
+
+		adjacent_difference(ia, ib, std::plus<>{});
+		CHECK_EQUAL(ib, {1, 4, 9, 16, 25});
+
+		S s[] = {{1}, {4}, {9}};
+		int out[3] = {};
+		adjacent_difference(s, out, std::minus<>{}, &S::i);
+		CHECK_EQUAL(out, {1, 3, 5});
+	}
+
+	{
+		// op sees the later element first.
+		std::vector<std::string> words{"a", "b", "c"};
+		std::vector<std::string> out(3);
+		adjacent_difference(words, out.begin(), std::plus<>{});
+		CHECK_EQUAL(out, {"a", "ba", "cb"});
+	}
+
+	test_vectorized<int>();
+	test_vectorized<unsigned>();
+	test_vectorized<long long>();
+	test_vectorized<float>();
+	test_vectorized<double>();
+
+	return ::test_result();
+}
@@ -0,0 +1,173 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/numeric/exclusive_scan.hpp>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include <stl2/detail/iterator/move_iterator.hpp>
+#include <stl2/detail/iterator/reverse_iterator.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	struct S {
+		int i;
+	};
+
+	// x -> a * x + b: composition is associative, but not commutative.
+	struct affine {
+		unsigned a, b;
+		bool operator==(const affine& that) const {
+			return a == that.a && b == that.b;
+		}
+	};
+	struct compose {
+		affine operator()(const affine& f, const affine& g) const {
+			return {f.a * g.a, f.b * g.a + g.b};
+		}
+	};
+
+	// The running sums of v from init, each exclusive of its element.
+	template<class T>
+	std::vector<T> exclusive_sums(const std::vector<T>& v, T init) {
+		std::vector<T> sums;
+		for (const T& x : v) {
+			sums.push_back(init);
+			init = init + x;
+		}
+		return sums;
+	}
+
+	constexpr bool test_constexpr() {
+		int a[] = {1, 2, 3, 4};
+		int b[4] = {};
+		ranges::ext::exclusive_scan(a, b, 10);
+		return b[0] == 10 && b[1] == 11 && b[2] == 13 && b[3] == 16;
+	}
+	static_assert(test_constexpr());
+
+	template<class T>
+	void test_vectorized() {
+		std::uniform_int_distribution<int> dist{-1000, 1000};
+		for (std::size_t n : {0u, 1u, 2u, 3u, 7u, 8u, 9u, 16u, 17u, 63u, 64u, 65u, 1000u}) {
+			std::vector<T> v(n), out(n + 1, T(42));
+			for (auto& x : v) x = static_cast<T>(dist(gen));
+			const auto expected = exclusive_sums(v, T(7));
+
+			auto res = ranges::ext::exclusive_scan(v, out.begin(), T(7));
+			CHECK(res.in == v.end());
+			CHECK(res.out == out.begin() + n);
+			CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+			CHECK(out[n] == T(42));
+
+			ranges::ext::exclusive_scan(ranges::make_move_iterator(v.begin()),
+				ranges::make_move_iterator(v.end()), out.begin(), T(7), std::plus<T>{});
+			CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+
+			const auto reversed = exclusive_sums(std::vector<T>(v.rbegin(), v.rend()), T(7));
+			ranges::ext::exclusive_scan(v.rbegin(), v.rend(), out.begin(), T(7));
+			CHECK(std::equal(reversed.begin(), reversed.end(), out.begin()));
+
+			ranges::ext::exclusive_scan(v, v.begin(), T(7));
+			CHECK(v == expected);
+		}
+	}
+
+	template<class EP>
+	void test_policy(EP policy) {
+		using ranges::ext::exclusive_scan;
+		for (std::size_t n : {0u, 1u, 5000u, 200000u}) {
+			std::uniform_int_distribution<int> dist{-1000, 1000};
+			std::vector<int> v(n), out(n);
+			for (auto& x : v) x = dist(gen);
+			const auto expected = exclusive_sums(v, 3);
+
+			auto res = exclusive_scan(policy, v, out.begin(), 3);
+			CHECK(res.in == v.end());
+			CHECK(res.out == out.end());
+			CHECK(out == expected);
+
+			std::vector<long> wide(n);
+			exclusive_scan(policy, v.begin(), v.end(), wide.begin(), 3L, std::plus<>{},
+				[](int x) { return long(x); });
+			CHECK(std::equal(expected.begin(), expected.end(), wide.begin()));
+
+			exclusive_scan(policy, v, v.begin(), 3);
+			CHECK(v == expected);
+
+			// Chunks are combined in order.
+			std::vector<affine> f(n);
+			for (std::size_t i = 0; i < n; ++i) {
+				f[i] = {2 * static_cast<unsigned>(i) + 1, static_cast<unsigned>(i)};
+			}
+			std::vector<affine> fexpected, fout(n);
+			affine acc{3, 5};
+			for (const auto& g : f) {
+				fexpected.push_back(acc);
+				acc = compose{}(acc, g);
+			}
+			exclusive_scan(policy, f, fout.begin(), affine{3, 5}, compose{});
+			CHECK(fout == fexpected);
+		}
+	}
+}
+
+int main() {
+	using ranges::ext::exclusive_scan;
+
+	{
+		int ia[] = {1, 2, 3, 4, 5};
+		int ib[5] = {};
+		using I = input_iterator<const int*>;
+		auto res = exclusive_scan(I(ia), sentinel<const int*>(ia + 5),
+			output_iterator<int*>(ib), 0);
+		CHECK(res.in == I(ia + 5));
+		CHECK(res.out.base() == ib + 5);
+		CHECK_EQUAL(ib, {0, 1, 3, 6, 10});
+
+		exclusive_scan(ia, ib, 1, std::multiplies<>{});
+		CHECK_EQUAL(ib, {1, 1, 2, 6, 24});
+
+		S s[] = {{1}, {2}, {3}};
+		long out[3] = {};
+		exclusive_scan(s, out, 5L, std::plus<>{}, &S::i);
+		CHECK_EQUAL(out, {5L, 6L, 8L});
+
+		std::vector<std::string> words{"a", "b", "c"};
+		std::vector<std::string> strings(3);
+		exclusive_scan(words, strings.begin(), std::string{">"});
+		CHECK_EQUAL(strings, {">", ">a", ">ab"});
+	}
+
+	test_vectorized<int>();
+	test_vectorized<unsigned>();
+	test_vectorized<long long>();
+	test_vectorized<float>();
+	test_vectorized<double>();
+
+	test_policy(ranges::ext::seq);
+	test_policy(ranges::ext::par);
+	{
+		ranges::ext::thread_pool none{0};
+		test_policy(ranges::ext::par.on(none));
+		ranges::ext::thread_pool three{3};
+		test_policy(ranges::ext::par_unseq.on(three));
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,157 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/numeric/inclusive_scan.hpp>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include <stl2/detail/iterator/reverse_iterator.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	struct S {
+		int i;
+	};
+
+	// x -> a * x + b: composition is associative, but not commutative.
+	struct affine {
+		unsigned a, b;
+		bool operator==(const affine& that) const {
+			return a == that.a && b == that.b;
+		}
+	};
+	struct compose {
+		affine operator()(const affine& f, const affine& g) const {
+			return {f.a * g.a, f.b * g.a + g.b};
+		}
+	};
+
+	constexpr bool test_constexpr() {
+		int a[] = {1, 2, 3, 4};
+		int b[4] = {};
+		ranges::ext::inclusive_scan(a, b);
+		return b[0] == 1 && b[1] == 3 && b[2] == 6 && b[3] == 10;
+	}
+	static_assert(test_constexpr());
+
+	// Values whose running sums the vector kernel computes exactly, in
+	// whatever grouping.
+	template<class T>
+	void test_vectorized() {
+		std::uniform_int_distribution<int> dist{-1000, 1000};
+		for (std::size_t n : {0u, 1u, 2u, 3u, 7u, 8u, 9u, 16u, 17u, 63u, 64u, 65u, 1000u}) {
+			std::vector<T> v(n), expected(n), out(n + 1, T(42));
+			for (auto& x : v) x = static_cast<T>(dist(gen));
+			std::partial_sum(v.begin(), v.end(), expected.begin());
+
+			auto res = ranges::ext::inclusive_scan(v, out.begin());
+			CHECK(res.in == v.end());
+			CHECK(res.out == out.begin() + n);
+			CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+			CHECK(out[n] == T(42));
+
+			std::partial_sum(v.rbegin(), v.rend(), expected.begin());
+			ranges::ext::inclusive_scan(v.rbegin(), v.rend(), out.begin(), std::plus<T>{});
+			CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+
+			std::partial_sum(v.begin(), v.end(), expected.begin());
+			ranges::ext::inclusive_scan(v, v.begin());
+			CHECK(v == expected);
+		}
+	}
+
+	template<class EP>
+	void test_policy(EP policy) {
+		using ranges::ext::inclusive_scan;
+		for (std::size_t n : {0u, 1u, 5000u, 200000u}) {
+			std::uniform_int_distribution<int> dist{-1000, 1000};
+			std::vector<int> v(n), expected(n), out(n);
+			for (auto& x : v) x = dist(gen);
+			std::partial_sum(v.begin(), v.end(), expected.begin());
+
+			auto res = inclusive_scan(policy, v, out.begin());
+			CHECK(res.in == v.end());
+			CHECK(res.out == out.end());
+			CHECK(out == expected);
+
+			std::vector<int> negated(n);
+			std::transform(expected.begin(), expected.end(), negated.begin(), std::negate<>{});
+			inclusive_scan(policy, v.begin(), v.end(), out.begin(), std::plus<>{},
+				std::negate<>{});
+			CHECK(out == negated);
+
+			inclusive_scan(policy, v, v.begin());
+			CHECK(v == expected);
+
+			// Chunks are combined in order.
+			std::vector<affine> f(n);
+			for (std::size_t i = 0; i < n; ++i) {
+				f[i] = {2 * static_cast<unsigned>(i) + 1, static_cast<unsigned>(i)};
+			}
+			std::vector<affine> fexpected(n), fout(n);
+			std::partial_sum(f.begin(), f.end(), fexpected.begin(), compose{});
+			inclusive_scan(policy, f, fout.begin(), compose{});
+			CHECK(fout == fexpected);
+		}
+	}
+}
+
+int main() {
+	using ranges::ext::inclusive_scan;
+
+	{
+		int ia[] = {1, 2, 3, 4, 5};
+		int ib[5] = {};
+		using I = input_iterator<const int*>;
+		auto res = inclusive_scan(I(ia), sentinel<const int*>(ia + 5),
+			output_iterator<int*>(ib));
+		CHECK(res.in == I(ia + 5));
+		CHECK(res.out.base() == ib + 5);
+		CHECK_EQUAL(ib, {1, 3, 6, 10, 15});
+
+		inclusive_scan(ia, ib, std::multiplies<>{});
+		CHECK_EQUAL(ib, {1, 2, 6, 24, 120});
+
+		S s[] = {{1}, {2}, {3}};
+		int out[3] = {};
+		inclusive_scan(s, out, std::plus<>{}, &S::i);
+		CHECK_EQUAL(out, {1, 3, 6});
+
+		std::vector<std::string> words{"a", "b", "c"};
+		std::vector<std::string> strings(3);
+		inclusive_scan(words, strings.begin());
+		CHECK_EQUAL(strings, {"a", "ab", "abc"});
+	}
+
+	test_vectorized<int>();
+	test_vectorized<unsigned>();
+	test_vectorized<long long>();
+	test_vectorized<float>();
+	test_vectorized<double>();
+
+	test_policy(ranges::ext::seq);
+	test_policy(ranges::ext::par);
+	{
+		ranges::ext::thread_pool none{0};
+		test_policy(ranges::ext::par.on(none));
+		ranges::ext::thread_pool three{3};
+		test_policy(ranges::ext::par_unseq.on(three));
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,78 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/numeric/inner_product.hpp>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	struct S {
+		int i;
+	};
+
+	constexpr int a[] = {1, 2, 3};
+	constexpr int b[] = {4, 5, 6, 7};
+	static_assert(ranges::ext::inner_product(a, b, 0) == 32);
+}
+
+int main() {
+	using ranges::ext::inner_product;
+
+	{
+		int ia[] = {1, 2, 3, 4, 5, 6};
+		int ib[] = {6, 5, 4, 3, 2, 1};
+		using I = input_iterator<const int*>;
+		CHECK(inner_product(I(ia), sentinel<const int*>(ia + 6),
+			I(ib), sentinel<const int*>(ib + 6), 0) == 56);
+		CHECK(inner_product(I(ia), sentinel<const int*>(ia + 6),
+			I(ib), sentinel<const int*>(ib + 2), 10) == 26);
+		CHECK(inner_product(ia, ib, 1, std::multiplies<>{}, std::plus<>{}) == 117649);
+		S s[] = {S{1}, S{2}, S{3}};
+		CHECK(inner_product(s, ia, 0, std::plus<>{}, std::multiplies<>{},
+			&S::i, [](int i) { return -i; }) == -14);
+	}
+
+	{
+		// The fold runs from left to right.
+		std::list<std::string> x{"a", "b", "c"};
+		std::vector<std::string> y{"1", "2", "3"};
+		CHECK(inner_product(x, y, std::string{">"}, std::plus<>{}, std::plus<>{}) ==
+			">a1b2c3");
+	}
+
+	{
+		// Integer dot products of arrays are vectorized.
+		std::uniform_int_distribution<int> dist{-1000, 1000};
+		for (std::size_t n : {0u, 1u, 3u, 16u, 17u, 63u, 64u, 65u, 1000u, 4099u}) {
+			std::vector<int> v(n), w(n + 5);
+			for (auto& e : v) e = dist(gen);
+			for (auto& e : w) e = dist(gen);
+			CHECK(inner_product(v, w, 7) ==
+				std::inner_product(v.begin(), v.end(), w.begin(), 7));
+			CHECK(inner_product(w, v, 7) ==
+				std::inner_product(v.begin(), v.end(), w.begin(), 7));
+			CHECK(inner_product(v.rbegin(), v.rend(), w.rbegin() + 5, w.rend(), 0) ==
+				std::inner_product(v.begin(), v.end(), w.begin(), 0));
+		}
+	}
+
+	return ::test_result();
+}
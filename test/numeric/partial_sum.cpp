@@ -0,0 +1,124 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/numeric/partial_sum.hpp>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include <stl2/detail/iterator/move_iterator.hpp>
+#include <stl2/detail/iterator/reverse_iterator.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	struct S {
+		int i;
+	};
+
+	constexpr bool test_constexpr() {
+		int a[] = {1, 2, 3, 4};
+		int b[4] = {};
+		auto res = ranges::ext::partial_sum(a, b);
+		return res.in == a + 4 && res.out == b + 4 &&
+			b[0] == 1 && b[1] == 3 && b[2] == 6 && b[3] == 10;
+	}
+	static_assert(test_constexpr());
+
+	template<class T>
+	void test_vectorized() {
+		std::uniform_int_distribution<int> dist{-1000, 1000};
+		for (std::size_t n : {0u, 1u, 2u, 3u, 7u, 8u, 9u, 16u, 17u, 63u, 64u, 65u, 1000u}) {
+			std::vector<T> v(n), expected(n), out(n + 1, T(42));
+			for (auto& x : v) x = static_cast<T>(dist(gen));
+			std::partial_sum(v.begin(), v.end(), expected.begin());
+
+			auto res = ranges::ext::partial_sum(v, out.begin());
+			CHECK(res.in == v.end());
+			CHECK(res.out == out.begin() + n);
+			CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+			CHECK(out[n] == T(42));
+
+			ranges::ext::partial_sum(ranges::make_move_iterator(v.begin()),
+				ranges::make_move_iterator(v.end()), out.begin(), std::plus<T>{});
+			CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+
+			std::partial_sum(v.rbegin(), v.rend(), expected.begin());
+			ranges::ext::partial_sum(v.rbegin(), v.rend(), out.begin());
+			CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+
+			// In place.
+			std::partial_sum(v.begin(), v.end(), expected.begin());
+			ranges::ext::partial_sum(v, v.begin());
+			CHECK(v == expected);
+		}
+	}
+}
+
+int main() {
+	using ranges::ext::partial_sum;
+
+	{
+		int ia[] = {1, 2, 3, 4, 5};
+		int ib[5] = {};
+		using I = input_iterator<const int*>;
+		auto res = partial_sum(I(ia), sentinel<const int*>(ia + 5),
+			output_iterator<int*>(ib));
+		CHECK(res.in == I(ia + 5));
+		CHECK(res.out.base() == ib + 5);
+		CHECK_EQUAL(ib, {1, 3, 6, 10, 15});
+
+		auto empty = partial_sum(I(ia), sentinel<const int*>(ia), ib);
+		CHECK(empty.out == ib);
+
+		partial_sum(ia, ib, std::multiplies<>{});
+		CHECK_EQUAL(ib, {1, 2, 6, 24, 120});
+		partial_sum(ia, ib, std::minus<>{});
+		CHECK_EQUAL(ib, {1, -1, -4, -8, -13});
+	}
+
+	{
+		// Folds run from left to right.
+		std::vector<std::string> words{"a", "b", "c"};
+		std::vector<std::string> out(3);
+		partial_sum(words, out.begin());
+		CHECK_EQUAL(out, {"a", "ab", "abc"});
+	}
+
+	{
+		S s[] = {{1}, {2}, {3}};
+		int out[3] = {};
+		partial_sum(s, out, std::plus<>{}, &S::i);
+		CHECK_EQUAL(out, {1, 3, 6});
+	}
+
+	test_vectorized<int>();
+	test_vectorized<unsigned>();
+	test_vectorized<long long>();
+
+	{
+		// Floating-point sums are not reassociated.
+		std::vector<float> v(1000);
+		std::uniform_real_distribution<float> dist{-1, 1};
+		for (auto& x : v) x = dist(gen);
+		std::vector<float> expected(v.size()), out(v.size());
+		std::partial_sum(v.begin(), v.end(), expected.begin());
+		partial_sum(v, out.begin());
+		CHECK(out == expected);
+	}
+
+	return ::test_result();
+}
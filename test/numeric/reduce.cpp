@@ -0,0 +1,111 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/numeric/reduce.hpp>
+#include <deque>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <stl2/detail/iterator/move_iterator.hpp>
+#include <stl2/detail/iterator/reverse_iterator.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	struct S {
+		int i;
+	};
+
+	constexpr int a[] = {1, 2, 3, 4, 5};
+	static_assert(ranges::ext::reduce(a, 0) == 15);
+
+	// Values whose sums and products the vector kernels compute exactly,
+	// whatever the order, so the results are comparable.
+	template<class T>
+	void test_vectorized() {
+		std::uniform_int_distribution<int> dist{-8, 8};
+		std::uniform_int_distribution<int> sign{0, 1};
+		for (std::size_t n : {0u, 1u, 3u, 7u, 16u, 17u, 63u, 64u, 65u, 1000u, 4099u}) {
+			std::vector<T> v(n);
+			for (auto& x : v) x = static_cast<T>(dist(gen));
+			const T sum = std::accumulate(v.begin(), v.end(), T(5));
+			CHECK(ranges::ext::reduce(v, T(5)) == sum);
+			CHECK(ranges::ext::reduce(v.rbegin(), v.rend(), T(5), std::plus<T>{}) == sum);
+			CHECK(ranges::ext::reduce(ranges::make_move_iterator(v.begin()),
+				ranges::make_move_iterator(v.end()), T(5)) == sum);
+
+			for (auto& x : v) x = static_cast<T>(sign(gen) ? 1 : -1);
+			CHECK(ranges::ext::reduce(v, T(3), std::multiplies<>{}) ==
+				std::accumulate(v.begin(), v.end(), T(3), std::multiplies<>{}));
+		}
+	}
+
+	template<class EP>
+	void test_policy(EP policy) {
+		using ranges::ext::reduce;
+		constexpr std::size_t n = 200000;
+		std::uniform_int_distribution<int> dist{-1000, 1000};
+		std::vector<int> v(n);
+		for (auto& x : v) x = dist(gen);
+		const long sum = std::accumulate(v.begin(), v.end(), 0L);
+		CHECK(reduce(policy, v, 0L) == sum);
+		CHECK(reduce(policy, v.begin(), v.end(), 0) == int(sum));
+		CHECK(reduce(policy, v.begin(), v.begin() + 1, 3) == v[0] + 3);
+		CHECK(reduce(policy, v.begin(), v.begin(), 3) == 3);
+		CHECK(reduce(policy, v, 0L, std::plus<>{}, [](int x) { return -x; }) == -sum);
+		CHECK(reduce(policy, v, 0, [](int x, int y) { return x > y ? x : y; }) == 1000);
+	}
+}
+
+int main() {
+	using ranges::ext::reduce;
+
+	{
+		int ia[] = {1, 2, 3, 4, 5, 6};
+		using I = input_iterator<const int*>;
+		CHECK(reduce(I(ia), sentinel<const int*>(ia + 6), 0) == 21);
+		CHECK(reduce(I(ia), sentinel<const int*>(ia), 10) == 10);
+		CHECK(reduce(ia, 10L) == 31L);
+		CHECK(reduce(ia, 1, std::multiplies<>{}) == 720);
+		std::list<S> s{S{1}, S{2}, S{3}};
+		CHECK(reduce(s, 0, std::plus<>{}, &S::i) == 6);
+	}
+
+	test_vectorized<int>();
+	test_vectorized<unsigned>();
+	test_vectorized<long long>();
+	test_vectorized<float>();
+	test_vectorized<double>();
+
+	{
+		// A deque is reduced a segment at a time.
+		std::deque<double> d;
+		for (int i = 0; i < 10000; ++i) d.push_back(i % 7);
+		CHECK(reduce(d, 0.5) == std::accumulate(d.begin(), d.end(), 0.5));
+	}
+
+	test_policy(ranges::ext::seq);
+	test_policy(ranges::ext::par);
+	{
+		ranges::ext::thread_pool none{0};
+		test_policy(ranges::ext::par.on(none));
+		ranges::ext::thread_pool three{3};
+		test_policy(ranges::ext::par_unseq.on(three));
+	}
+
+	return ::test_result();
+}
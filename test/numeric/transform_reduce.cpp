@@ -0,0 +1,113 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/numeric/transform_reduce.hpp>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <stl2/detail/iterator/reverse_iterator.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	struct S {
+		int i;
+	};
+
+	constexpr int a[] = {1, 2, 3};
+	constexpr int b[] = {4, 5, 6, 7};
+	static_assert(ranges::ext::transform_reduce(a, b, 0) == 32);
+	static_assert(ranges::ext::transform_reduce(a, 0, std::plus<>{},
+		[](int x) { return x * x; }) == 14);
+
+	// Dot products of small integral values, which the vector kernels
+	// compute exactly whatever the order.
+	template<class T>
+	void test_vectorized() {
+		std::uniform_int_distribution<int> dist{-8, 8};
+		for (std::size_t n : {0u, 1u, 3u, 7u, 16u, 17u, 63u, 64u, 65u, 1000u, 4099u}) {
+			std::vector<T> v(n), w(n + 3);
+			for (auto& x : v) x = static_cast<T>(dist(gen));
+			for (auto& x : w) x = static_cast<T>(dist(gen));
+			const T dot = std::inner_product(v.begin(), v.end(), w.begin(), T(2));
+			CHECK(ranges::ext::transform_reduce(v, w, T(2)) == dot);
+			CHECK(ranges::ext::transform_reduce(w, v, T(2), std::plus<T>{},
+				std::multiplies<T>{}) == dot);
+			CHECK(ranges::ext::transform_reduce(v.rbegin(), v.rend(),
+				w.rbegin() + 3, w.rend(), T(2)) == dot);
+		}
+	}
+
+	template<class EP>
+	void test_policy(EP policy) {
+		using ranges::ext::transform_reduce;
+		constexpr std::size_t n = 200000;
+		std::uniform_int_distribution<int> dist{-100, 100};
+		std::vector<int> v(n), w(n + 1);
+		for (auto& x : v) x = dist(gen);
+		for (auto& x : w) x = dist(gen);
+		long squares = 0, dot = 0;
+		for (std::size_t i = 0; i < n; ++i) {
+			squares += long(v[i]) * v[i];
+			dot += long(v[i]) * w[i];
+		}
+		const auto square = [](int x) { return long(x) * x; };
+		CHECK(transform_reduce(policy, v, 0L, std::plus<>{}, square) == squares);
+		CHECK(transform_reduce(policy, v.begin(), v.end(), 0L, std::plus<>{}, square,
+			[](int x) { return -x; }) == squares);
+		CHECK(transform_reduce(policy, v.begin(), v.begin(), 3L, std::plus<>{}, square) == 3L);
+		CHECK(transform_reduce(policy, v, w, 0) == int(dot));
+		CHECK(transform_reduce(policy, w.begin(), w.end(), v.begin(), v.end(), 0L,
+			std::plus<>{}, [](int x, int y) { return long(x) * y; }) == dot);
+	}
+}
+
+int main() {
+	using ranges::ext::transform_reduce;
+
+	{
+		int ia[] = {1, 2, 3, 4, 5, 6};
+		int ib[] = {6, 5, 4, 3, 2, 1};
+		using I = input_iterator<const int*>;
+		CHECK(transform_reduce(I(ia), sentinel<const int*>(ia + 6), 0,
+			std::plus<>{}, [](int x) { return 2 * x; }) == 42);
+		CHECK(transform_reduce(I(ia), sentinel<const int*>(ia + 6),
+			I(ib), sentinel<const int*>(ib + 2), 10) == 26);
+		CHECK(transform_reduce(ia, ib, 1, std::multiplies<>{}, std::plus<>{}) == 117649);
+		std::list<S> s{S{1}, S{2}, S{3}};
+		CHECK(transform_reduce(s, 0, std::plus<>{}, std::negate<>{}, &S::i) == -6);
+		CHECK(transform_reduce(s, ia, 0, std::plus<>{}, std::multiplies<>{},
+			&S::i, [](int i) { return -i; }) == -14);
+	}
+
+	test_vectorized<int>();
+	test_vectorized<unsigned>();
+	test_vectorized<long long>();
+	test_vectorized<float>();
+	test_vectorized<double>();
+
+	test_policy(ranges::ext::seq);
+	test_policy(ranges::ext::par);
+	{
+		ranges::ext::thread_pool none{0};
+		test_policy(ranges::ext::par.on(none));
+		ranges::ext::thread_pool three{3};
+		test_policy(ranges::ext::par_unseq.on(three));
+	}
+
+	return ::test_result();
+}
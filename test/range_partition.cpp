@@ -0,0 +1,148 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/range/partition.hpp>
+
+#include <list>
+#include <vector>
+
+#include <stl2/detail/span.hpp>
+#include <stl2/view/drop.hpp>
+#include <stl2/view/filter.hpp>
+#include <stl2/view/iota.hpp>
+#include <stl2/view/join.hpp>
+#include <stl2/view/reverse.hpp>
+#include <stl2/view/subrange.hpp>
+#include <stl2/view/take.hpp>
+#include <stl2/view/take_while.hpp>
+#include <stl2/view/transform.hpp>
+#include "simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	// The concatenation of the pieces, and their sizes.
+	template<class Pieces>
+	std::pair<std::vector<int>, std::vector<int>> flatten(Pieces&& pieces) {
+		std::vector<int> elements, sizes;
+		for (auto&& piece : pieces) {
+			int n = 0;
+			for (auto&& e : piece) {
+				elements.push_back(e);
+				++n;
+			}
+			sizes.push_back(n);
+		}
+		return {elements, sizes};
+	}
+}
+
+int main() {
+	using namespace ranges;
+
+	{
+		auto r = view::iota(0, 10);
+		auto p = ext::partition_range(r, 3);
+		static_assert(Same<decltype(p), std::vector<iota_view<int, int>>>);
+		auto [elements, sizes] = flatten(p);
+		CHECK_EQUAL(elements, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+		CHECK_EQUAL(sizes, {4, 3, 3});
+		static_assert(!ext::PartitionableRange<iota_view<int>>);
+	}
+
+	{
+		// Pieces may be empty, but there are always k of them.
+		auto p = ext::partition_range(view::iota(0, 2), 4);
+		CHECK(p.size() == 4u);
+		CHECK_EQUAL(flatten(p).second, {1, 1, 0, 0});
+	}
+
+	{
+		std::vector<int> v{1, 2, 3, 4, 5, 6, 7};
+		auto p = ext::partition_range(v, 2);
+		static_assert(Same<ext::partition_piece_t<std::vector<int>&>,
+			subrange<std::vector<int>::iterator>>);
+		CHECK(p[0].begin() == v.begin());
+		CHECK(p[1].end() == v.end());
+		CHECK_EQUAL(flatten(p).second, {4, 3});
+		static_assert(!ext::PartitionableRange<std::vector<int>>);
+		static_assert(!ext::PartitionableRange<std::list<int>&>);
+
+		auto sp = ext::partition_range(subrange{v.begin() + 1, v.end()}, 3);
+		CHECK_EQUAL(flatten(sp).first, {2, 3, 4, 5, 6, 7});
+
+		auto s = ext::partition_range(ext::make_span(v), 3);
+		static_assert(Same<ext::partition_piece_t<ext::span<int>>, ext::span<int>>);
+		CHECK(s[1].data() == v.data() + 3);
+		CHECK_EQUAL(flatten(s).second, {3, 2, 2});
+	}
+
+	{
+		// A lazy pipeline splits into pipelines over pieces of its source.
+		int calls = 0;
+		auto r = view::iota(0, 100)
+			| view::transform([&calls](int i) { ++calls; return i * i; })
+			| view::filter([](int i) { return i % 3 == 0; });
+		auto p = ext::partition_range(r, 4);
+		CHECK(calls == 0);
+		CHECK(p.size() == 4u);
+		std::vector<int> expected;
+		for (int i = 0; i < 100; i += 3) expected.push_back(i * i);
+		CHECK_EQUAL(flatten(p).first, expected);
+		CHECK_EQUAL(flatten(p).second, {9, 8, 8, 9});
+	}
+
+	{
+		auto t = ext::partition_range(view::iota(0) | view::take(10), 3);
+		CHECK_EQUAL(flatten(t).second, {4, 3, 3});
+		CHECK(*t[2].begin() == 7);
+
+		// A base that is neither sized nor unbounded may end before count,
+		// so its iterators cannot bound the pieces.
+		auto short_base = view::iota(0) | view::ext::take_while([](int i) { return i < 5; });
+		static_assert(RandomAccessRange<decltype(short_base)>);
+		static_assert(!ext::PartitionableRange<decltype(short_base | view::take(10))>);
+
+		// A sized base shorter than count bounds the pieces.
+		std::vector<int> w{0, 1, 2, 3, 4};
+		auto s = ext::partition_range(w | view::take(10), 2);
+		CHECK_EQUAL(flatten(s).first, {0, 1, 2, 3, 4});
+		CHECK_EQUAL(flatten(s).second, {3, 2});
+
+		std::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+		auto d = ext::partition_range(v | view::ext::drop(4), 4);
+		CHECK_EQUAL(flatten(d).first, {4, 5, 6, 7, 8, 9});
+		CHECK_EQUAL(flatten(d).second, {2, 2, 1, 1});
+		CHECK(flatten(ext::partition_range(v | view::ext::drop(20), 2)).first.empty());
+
+		auto rv = ext::partition_range(v | view::reverse, 3);
+		CHECK_EQUAL(flatten(rv).first, {9, 8, 7, 6, 5, 4, 3, 2, 1, 0});
+		CHECK_EQUAL(flatten(rv).second, {3, 3, 4});
+	}
+
+	{
+		// join splits between whole inner ranges.
+		std::vector<std::vector<int>> vv{{0, 1, 2}, {}, {3}, {4, 5}, {6, 7, 8, 9}};
+		auto j = vv | view::join;
+		auto p = ext::partition_range(j, 2);
+		CHECK_EQUAL(flatten(p).first, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+		CHECK_EQUAL(flatten(p).second, {4, 6});
+
+		auto tj = ext::partition_range(j | view::transform([](int i) { return -i; }), 5);
+		CHECK_EQUAL(flatten(tj).second, {3, 0, 1, 2, 4});
+		CHECK(*tj[4].begin() == -6);
+
+		std::list<std::vector<int>> lv{{1}, {2}};
+		static_assert(!ext::PartitionableRange<decltype(lv | view::join)>);
+	}
+
+	return ::test_result();
+}
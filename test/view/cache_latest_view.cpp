@@ -0,0 +1,75 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/cache_latest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/iterator/insert_iterators.hpp>
+#include <stl2/view/filter.hpp>
+#include <stl2/view/iota.hpp>
+#include <stl2/view/transform.hpp>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+int main() {
+	using namespace ranges;
+
+	{
+		int calls = 0;
+		auto square = [&calls](int i) { ++calls; return i * i; };
+		auto rng = view::iota(0, 10) | view::transform(square) | view::cache_latest
+			| view::filter([](int i) { return i % 2 == 0; });
+		static_assert(InputRange<decltype(rng)>);
+		static_assert(!ForwardRange<decltype(rng)>);
+		std::vector<int> out;
+		copy(rng, back_inserter(out));
+		CHECK_EQUAL(out, {0, 4, 16, 36, 64});
+		CHECK(calls == 10);
+	}
+
+	{
+		auto rng = view::iota(0, 4)
+			| view::transform([](int i) { return std::string(i, 'x'); })
+			| view::cache_latest;
+		using R = decltype(rng);
+		static_assert(View<R>);
+		static_assert(SizedRange<R>);
+		static_assert(!CommonRange<R>);
+		static_assert(Same<std::string&, iter_reference_t<iterator_t<R>>>);
+		static_assert(Same<std::string, iter_rvalue_reference_t<iterator_t<R>>>);
+		CHECK(rng.size() == 4);
+		auto i = rng.begin();
+		CHECK((rng.end() - i) == 4);
+		++i;
+		CHECK(*i == "x");
+		*i += "y";
+		CHECK(*i == "xy");
+		++i;
+		CHECK(*i == "xx");
+		CHECK(iter_move(i) == "xx");
+	}
+
+	{
+		std::vector<int> v{1, 2, 3};
+		auto rng = v | view::cache_latest;
+		static_assert(Same<int&, iter_reference_t<iterator_t<decltype(rng)>>>);
+		auto i = rng.begin();
+		CHECK(&*i == &v[0]);
+		*i = 7;
+		CHECK(v[0] == 7);
+	}
+
+	return ::test_result();
+}
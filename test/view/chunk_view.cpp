@@ -0,0 +1,119 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/chunk.hpp>
+
+#include <forward_list>
+#include <list>
+#include <sstream>
+#include <vector>
+
+#include <stl2/view/iota.hpp>
+#include <stl2/view/istream.hpp>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+int main() {
+	using namespace ranges;
+
+	{
+		std::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+		auto c = v | view::chunk(3);
+		using C = decltype(c);
+		static_assert(View<C>);
+		static_assert(RandomAccessRange<C>);
+		static_assert(SizedRange<C>);
+		static_assert(CommonRange<C>);
+		static_assert(RandomAccessRange<const C>);
+		static_assert(Same<iter_value_t<iterator_t<C>>,
+			subrange<std::vector<int>::iterator>>);
+		CHECK(c.size() == 4u);
+		CHECK((c.end() - c.begin()) == 4);
+		CHECK_EQUAL(c[0], {0, 1, 2});
+		CHECK_EQUAL(c[3], {9});
+		CHECK_EQUAL(*(c.begin() + 2), {6, 7, 8});
+		CHECK_EQUAL(*--c.end(), {9});
+		CHECK_EQUAL(*(c.end() - 2), {6, 7, 8});
+		auto i = c.end();
+		i -= 4;
+		CHECK(i == c.begin());
+		int n = 0;
+		for (auto chunk : c) {
+			CHECK(*chunk.begin() == 3 * n);
+			++n;
+		}
+		CHECK(n == 4);
+
+		auto e = view::chunk(v, 5);
+		CHECK(e.size() == 2u);
+		CHECK_EQUAL(*--e.end(), {5, 6, 7, 8, 9});
+		std::vector<int> empty;
+		CHECK(view::chunk(empty, 2).empty());
+	}
+
+	{
+		std::list<int> l{1, 2, 3, 4, 5};
+		auto c = view::chunk(l, 2);
+		static_assert(BidirectionalRange<decltype(c)>);
+		static_assert(!RandomAccessRange<decltype(c)>);
+		static_assert(CommonRange<decltype(c)>);
+		CHECK(c.size() == 3u);
+		CHECK_EQUAL(*--c.end(), {5});
+		CHECK_EQUAL(*----c.end(), {3, 4});
+
+		std::forward_list<int> fl{1, 2, 3, 4, 5, 6};
+		auto f = view::chunk(fl, 4);
+		static_assert(ForwardRange<decltype(f)>);
+		static_assert(CommonRange<decltype(f)>);
+		static_assert(!SizedRange<decltype(f)>);
+		CHECK(distance(f) == 2);
+		CHECK_EQUAL(*++f.begin(), {5, 6});
+
+		// An infinite range has infinitely many chunks.
+		auto inf = view::iota(0) | view::chunk(4);
+		CHECK_EQUAL(*++inf.begin(), {4, 5, 6, 7});
+		CHECK((inf.begin()[10].begin() - (*inf.begin()).begin()) == 40);
+	}
+
+	{
+		// Each element of an input range is read exactly once, whether or
+		// not the chunks are read through.
+		std::istringstream ss{"0 1 2 3 4 5 6 7 8 9 10"};
+		auto c = view::istream<int>(ss) | view::chunk(4);
+		static_assert(InputRange<decltype(c)>);
+		static_assert(!ForwardRange<decltype(c)>);
+		std::vector<std::vector<int>> chunks;
+		for (auto chunk : c) {
+			chunks.emplace_back();
+			for (int x : chunk) {
+				chunks.back().push_back(x);
+				if (x == 5) break;
+			}
+		}
+		CHECK(chunks.size() == 3u);
+		CHECK_EQUAL(chunks[0], {0, 1, 2, 3});
+		CHECK_EQUAL(chunks[1], {4, 5});
+		CHECK_EQUAL(chunks[2], {8, 9, 10});
+
+		std::istringstream ss2{"1 2 3 4 5 6"};
+		auto c2 = view::istream<int>(ss2) | view::chunk(2);
+		int sum = 0, count = 0;
+		for (auto chunk : c2) {
+			++count;
+			for (int x : chunk) sum += x;
+		}
+		CHECK(count == 3);
+		CHECK(sum == 21);
+	}
+
+	return ::test_result();
+}
@@ -12,8 +12,11 @@
 //
 #include <stl2/view/istream.hpp>
 
+#include <limits>
 #include <sstream>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -39,5 +42,93 @@ int main() {
 	constexpr std::string_view test = "abcd3210";
 	std::istringstream ss{test.data()};
 	CHECK_EQUAL(ranges::view::istream<moveonly>(ss), test);
+
+	{
+		using namespace ranges;
+		std::istringstream in{"  1 -2\t+3\n\n 40000000000 5"};
+		auto v = view::ext::bulk_istream<long long>(in);
+		static_assert(View<decltype(v)>);
+		static_assert(InputRange<decltype(v)>);
+		static_assert(Same<iter_reference_t<iterator_t<decltype(v)>>, long long&>);
+		CHECK_EQUAL(v, {1ll, -2ll, 3ll, 40000000000ll, 5ll});
+		CHECK(in.eof());
+		CHECK(in.fail());
+		CHECK(!in.bad());
+	}
+
+	{
+		// Copies share the buffer and position rather than copying them.
+		using namespace ranges;
+		std::istringstream in{"1 2 3 4"};
+		auto v = view::ext::bulk_istream<int>(in, 1);
+		auto i = v.begin();
+		CHECK(*i == 1);
+		{
+			auto w = v;
+			v = w;
+		}
+		++i;
+		CHECK(*i == 2);
+		CHECK(*++i == 3);
+	}
+
+	{
+		// Tokens that straddle blocks, and blocks shorter than a token.
+		using namespace ranges;
+		std::string text;
+		std::vector<int> expected;
+		for (int i = 0; i < 1000; ++i) {
+			expected.push_back(i * 7919 - 3000000);
+			text += std::to_string(expected.back());
+			text += i % 3 ? " " : "\n";
+		}
+		for (std::size_t block : {1u, 3u, 7u, 4096u, 1u << 20}) {
+			std::istringstream in{text};
+			std::vector<int> out;
+			for (int i : view::ext::bulk_istream<int>(in, block)) out.push_back(i);
+			CHECK(out == expected);
+		}
+	}
+
+	{
+		using namespace ranges;
+		std::istringstream in{"1.5 -0.25 1e3 +2"};
+		CHECK_EQUAL(view::ext::bulk_istream<double>(in), {1.5, -0.25, 1000.0, 2.0});
+	}
+
+	{
+		// Like operator>>, a malformed or out-of-range token ends the range
+		// with failbit set, but not eofbit.
+		using namespace ranges;
+		std::istringstream bad{"1 2 x3 4"};
+		CHECK_EQUAL(view::ext::bulk_istream<int>(bad), {1, 2});
+		CHECK(bad.fail());
+		CHECK(!bad.eof());
+
+		std::istringstream wide{"65535 65536"};
+		CHECK_EQUAL(view::ext::bulk_istream<unsigned short>(wide), {65535});
+		CHECK(wide.fail());
+
+		// Also like operator>>, unsigned types take a leading '-', which
+		// negates modulo 2^N.
+		const char signs[] = "3 -2 -0 +4 -4294967295 --5";
+		std::istringstream u1{signs}, u2{signs};
+		const std::vector<unsigned> expected{3u, 4294967294u, 0u, 4u, 1u};
+		std::vector<unsigned> out;
+		auto extracted = view::istream<unsigned>(u1);
+		for (unsigned x : extracted) out.push_back(x);
+		CHECK(out == expected);
+		out.clear();
+		for (unsigned x : view::ext::bulk_istream<unsigned>(u2)) out.push_back(x);
+		CHECK(out == expected);
+		CHECK(u1.fail());
+		CHECK(u2.fail());
+
+		std::istringstream empty{" \n "};
+		auto e = view::ext::bulk_istream<int>(empty);
+		CHECK(e.begin() == e.end());
+		CHECK(empty.eof());
+	}
+
 	return ::test_result();
 }
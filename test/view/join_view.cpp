@@ -13,7 +13,12 @@
 #include <stl2/view/iota.hpp>
 #include <stl2/view/transform.hpp>
 #include <stl2/view/filter.hpp>
+#include <stl2/detail/algorithm/copy.hpp>
 #include <stl2/detail/algorithm/count.hpp>
+#include <stl2/detail/algorithm/fill.hpp>
+#include <stl2/detail/algorithm/find.hpp>
+#include <stl2/detail/algorithm/find_if.hpp>
+#include <stl2/detail/algorithm/for_each.hpp>
 #include <stl2/detail/algorithm/transform.hpp>
 #include <stl2/detail/iterator/insert_iterators.hpp>
 #include <memory>
@@ -79,5 +84,68 @@ int main()
 		static_assert(!CommonRange<decltype(rng2)>);
 	}
 
+	{
+		// Segmented iteration: algorithms run over one inner vector at a time.
+		std::vector<std::vector<int>> vv{{}, {1, 2, 3}, {}, {}, {4}, {5, 6}, {}};
+		join_view jv{vv};
+		using I = iterator_t<decltype(jv)>;
+		static_assert(ext::SegmentedIterator<I>);
+		static_assert(ext::SegmentedIterator<iterator_t<const decltype(jv)>>);
+		static_assert(!ext::SegmentedIterator<int*>);
+		static_assert(!ext::SegmentedIterator<iterator_t<std::vector<int>>>);
+
+		int segments = 0;
+		ext::for_each_segment(jv.begin(), jv.end(), [&](auto&& seg) {
+			static_assert(Same<decltype(seg.begin()), std::vector<int>::iterator>);
+			segments += seg.begin() != seg.end();
+			return true;
+		});
+		CHECK(segments == 3);
+
+		std::vector<int> out(7, 0);
+		auto c = copy(jv, out.begin());
+		CHECK(c.in == jv.end());
+		CHECK(c.out == out.begin() + 6);
+		CHECK_EQUAL(out, {1, 2, 3, 4, 5, 6, 0});
+
+		int sum = 0;
+		auto fe = for_each(jv, [&](int i) { sum += i; }, [](int i) { return i * 10; });
+		CHECK(fe.in == jv.end());
+		CHECK(sum == 210);
+
+		auto t = transform(jv, out.begin(), [](int i) { return -i; });
+		CHECK(t.in == jv.end());
+		CHECK(t.out == out.begin() + 6);
+		CHECK_EQUAL(out, {-1, -2, -3, -4, -5, -6, 0});
+
+		// Matches compose back into join_view iterators.
+		auto f = find(jv, 4);
+		CHECK(*f == 4);
+		CHECK(*++f == 5);
+		CHECK(find(jv, 7) == jv.end());
+		auto g = find_if(jv, [](int i) { return i > 4; });
+		CHECK(*g == 5);
+		CHECK(*++g == 6);
+		CHECK(++g == jv.end());
+		CHECK(find_if(jv, [](int i) { return i > 6; }) == jv.end());
+
+		// Ranges that begin and end in the middle of segments.
+		auto first = next(jv.begin()), last = next(jv.begin(), 5);
+		CHECK(count(first, last, 1) == 0);
+		CHECK(count(first, last, 5) == 1);
+		CHECK(count(first, last, 6) == 0);
+		CHECK(find(first, last, 6) == last);
+		CHECK(find(last, last, 6) == last);
+		CHECK(*find(first, last, 3) == 3);
+		CHECK(fill(first, last, 0) == last);
+		CHECK_EQUAL(jv, {1, 0, 0, 0, 0, 6});
+		CHECK(fill(jv, 9) == jv.end());
+		CHECK(count(jv, 9) == 6);
+
+		const auto& cjv = jv;
+		CHECK(count(cjv, 9) == 6);
+		CHECK(find(cjv.begin(), cjv.end(), 9) == cjv.begin());
+	}
+
 	return ::test_result();
 }
@@ -0,0 +1,114 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/mapped_file.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <stl2/detail/algorithm/count.hpp>
+#include <stl2/detail/algorithm/find.hpp>
+#include <stl2/detail/algorithm/fill.hpp>
+#include <stl2/view/split.hpp>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	// A temporary file holding contents, removed on destruction.
+	struct temp_file {
+		std::string path;
+
+		explicit temp_file(const std::string& contents) {
+			char name[] = "/tmp/stl2_mapped_file_XXXXXX";
+			const int fd = ::mkstemp(name);
+			CHECK(fd >= 0);
+			CHECK(::write(fd, contents.data(), contents.size()) ==
+				static_cast<ssize_t>(contents.size()));
+			::close(fd);
+			path = name;
+		}
+		~temp_file() { std::remove(path.c_str()); }
+	};
+}
+
+int main() {
+	using namespace ranges;
+	using ext::mapped_file_advice;
+	using ext::mapped_file_view;
+
+	static_assert(View<mapped_file_view<>>);
+	static_assert(ContiguousRange<mapped_file_view<>>);
+	static_assert(SizedRange<mapped_file_view<>>);
+	static_assert(Same<iterator_t<mapped_file_view<>>, const char*>);
+	static_assert(Same<iterator_t<mapped_file_view<int>>, int*>);
+
+	{
+		const temp_file f{"alpha\nbeta\n\ngamma\n"};
+		mapped_file_view<> v{f.path, mapped_file_advice::sequential};
+		CHECK(v.size() == 18);
+		CHECK(std::string(v.begin(), v.end()) == "alpha\nbeta\n\ngamma\n");
+		CHECK(count(v, '\n') == 4);
+		CHECK(find(v, 'g') == v.data() + 12);
+
+		std::vector<std::string> lines;
+		for (auto&& line : v | view::split('\n')) {
+			std::string s;
+			for (char c : line) s.push_back(c);
+			lines.push_back(s);
+		}
+		CHECK_EQUAL(lines, {"alpha", "beta", "", "gamma"});
+
+		// Copies share the mapping, which outlives the original.
+		auto copy = v;
+		v = mapped_file_view<>{};
+		CHECK(v.empty());
+		CHECK(copy.data()[0] == 'a');
+		CHECK(copy.advise(mapped_file_advice::random));
+		CHECK(copy.advise(mapped_file_advice::willneed));
+		copy.advise(mapped_file_advice::hugepage);
+	}
+
+	{
+		// Only whole elements are part of the view, and stores reach the file.
+		const temp_file f{std::string(4 * sizeof(int) + 1, '\0')};
+		{
+			mapped_file_view<int> v{f.path};
+			CHECK(v.size() == 4);
+			fill(v, 42);
+		}
+		mapped_file_view<const int> v{f.path.c_str()};
+		CHECK(count(v, 42) == 4);
+	}
+
+	{
+		const temp_file f{""};
+		mapped_file_view<> v{f.path};
+		CHECK(v.empty());
+		CHECK(v.begin() == v.end());
+		CHECK(!v.advise(mapped_file_advice::sequential));
+	}
+
+	{
+		bool threw = false;
+		try {
+			mapped_file_view<> v{"/nonexistent/stl2/mapped_file"};
+		} catch (const std::system_error& e) {
+			threw = e.code() == std::errc::no_such_file_or_directory;
+		}
+		CHECK(threw);
+	}
+
+	return ::test_result();
+}
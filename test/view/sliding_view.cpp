@@ -0,0 +1,82 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/sliding.hpp>
+
+#include <forward_list>
+#include <list>
+#include <vector>
+
+#include <stl2/detail/algorithm/count_if.hpp>
+#include <stl2/view/iota.hpp>
+#include <stl2/view/take_while.hpp>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+int main() {
+	using namespace ranges;
+
+	{
+		std::vector<int> v{0, 1, 2, 3, 4, 5};
+		auto s = v | view::sliding(3);
+		using S = decltype(s);
+		static_assert(View<S>);
+		static_assert(RandomAccessRange<S>);
+		static_assert(SizedRange<S>);
+		static_assert(CommonRange<S>);
+		static_assert(RandomAccessRange<const S>);
+		CHECK(s.size() == 4u);
+		CHECK((s.end() - s.begin()) == 4);
+		CHECK_EQUAL(s[0], {0, 1, 2});
+		CHECK_EQUAL(s[3], {3, 4, 5});
+		CHECK_EQUAL(*--s.end(), {3, 4, 5});
+		int sums[4] = {};
+		int* out = sums;
+		for (auto window : s) {
+			for (int x : window) *out += x;
+			++out;
+		}
+		CHECK_EQUAL(sums, {3, 6, 9, 12});
+
+		CHECK(view::sliding(v, 6).size() == 1u);
+		CHECK(view::sliding(v, 7).size() == 0u);
+		CHECK(view::sliding(v, 7).empty());
+		CHECK(view::sliding(v, 1).size() == 6u);
+	}
+
+	{
+		std::list<int> l{1, 2, 3, 4};
+		auto s = view::sliding(l, 2);
+		static_assert(BidirectionalRange<decltype(s)>);
+		static_assert(CommonRange<decltype(s)>);
+		static_assert(!Range<const decltype(s)>);
+		CHECK(s.size() == 3u);
+		CHECK_EQUAL(*s.begin(), {1, 2});
+		CHECK_EQUAL(*--s.end(), {3, 4});
+		CHECK(distance(s) == 3);
+		CHECK(view::sliding(l, 5).begin() == view::sliding(l, 5).end());
+
+		std::forward_list<int> fl{1, 2, 3, 4, 5};
+		auto f = view::sliding(fl, 4);
+		static_assert(ForwardRange<decltype(f)>);
+		static_assert(!BidirectionalRange<decltype(f)>);
+		CHECK(distance(f) == 2);
+		CHECK_EQUAL(*++f.begin(), {2, 3, 4, 5});
+
+		auto w = view::iota(0) | view::ext::take_while([](int i) { return i < 10; })
+			| view::sliding(3);
+		static_assert(!CommonRange<decltype(w)>);
+		CHECK(count_if(w, [](auto r) { return *r.begin() % 2 == 0; }) == 4);
+	}
+
+	return ::test_result();
+}
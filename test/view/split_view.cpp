@@ -17,6 +17,7 @@
 
 #include <list>
 #include <sstream>
+#include <vector>
 
 namespace ranges = __stl2;
 
@@ -215,5 +216,36 @@ int main() {
 		CHECK(i == sv.end());
 	}
 
+	{
+		// Delimiters in contiguous characters are found with memchr or the
+		// SIMD searcher; runs of delimiters and a leading delimiter still
+		// yield empty pieces.
+		auto pieces = [](auto&& rng, auto&& pattern) {
+			std::vector<std::string> result;
+			for (auto&& piece : view::split(rng, pattern)) {
+				std::string s;
+				for (char c : piece) s.push_back(c);
+				result.push_back(s);
+			}
+			return result;
+		};
+		std::string text(200, 'x');
+		text[0] = text[64] = text[65] = text[199] = '\n';
+		using V = std::vector<std::string>;
+		static_assert(__split_memsearchable<ref_view<std::string>,
+			single_view<char>>);
+		CHECK(pieces(text, '\n') ==
+			V{"", std::string(63, 'x'), "", std::string(133, 'x')});
+
+		std::string csv = "ab, cd,, ,e, ";
+		std::string delim = ", ";
+		static_assert(__split_memsearchable<ref_view<std::string>,
+			ref_view<std::string>>);
+		CHECK(pieces(csv, delim) == V{"ab", "cd,", ",e"});
+		CHECK(pieces(std::string{"abc"}, delim) == V{"abc"});
+		CHECK(pieces(std::string{", , "}, delim) == V{"", ""});
+		CHECK(pieces(std::string{"a,"}, delim) == V{"a,"});
+	}
+
 	return test_result();
 }
@@ -0,0 +1,135 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/stride.hpp>
+
+#include <forward_list>
+#include <list>
+#include <sstream>
+#include <vector>
+
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/count.hpp>
+#include <stl2/detail/iterator/insert_iterators.hpp>
+#include <stl2/detail/span.hpp>
+#include <stl2/view/iota.hpp>
+#include <stl2/view/istream.hpp>
+#include <stl2/view/reverse.hpp>
+#include <stl2/view/take_while.hpp>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+int main() {
+	using namespace ranges;
+
+	{
+		std::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+		auto s = v | view::stride(3);
+		using S = decltype(s);
+		static_assert(View<S>);
+		static_assert(RandomAccessRange<S>);
+		static_assert(SizedRange<S>);
+		static_assert(CommonRange<S>);
+		static_assert(RandomAccessRange<const S>);
+		static_assert(!ContiguousRange<S>);
+		CHECK(s.size() == 4u);
+		CHECK((s.end() - s.begin()) == 4);
+		CHECK_EQUAL(s, {0, 3, 6, 9});
+		// end() sits on the underlying end, not one stride past it.
+		CHECK(s.end().base() == v.end());
+		CHECK(*--s.end() == 9);
+		CHECK(*(s.end() - 2) == 6);
+		CHECK(s.begin()[3] == 9);
+		CHECK((s.begin() + 4) == s.end());
+		CHECK((s.end() - 4) == s.begin());
+		CHECK_EQUAL(s | view::reverse, {9, 6, 3, 0});
+
+		auto e = v | view::stride(5);
+		CHECK_EQUAL(e, {0, 5});
+		CHECK(*--e.end() == 5);
+		CHECK(e.size() == 2u);
+		CHECK_EQUAL(v | view::stride(20), {0});
+		CHECK((v | view::stride(1)).size() == 10u);
+	}
+
+	{
+		// Not common: the iota end sentinel is O(1) to reach.
+		auto s = view::iota(0, 10) | view::stride(4);
+		static_assert(RandomAccessRange<decltype(s)>);
+		static_assert(SizedRange<decltype(s)>);
+		CHECK(s.size() == 3);
+		CHECK_EQUAL(s, {0, 4, 8});
+		auto i = view::iota(0) | view::stride(7);
+		CHECK(i.begin()[3] == 21);
+	}
+
+	{
+		std::list<int> l{1, 2, 3, 4, 5, 6, 7};
+		auto s = l | view::stride(2);
+		static_assert(BidirectionalRange<decltype(s)>);
+		static_assert(CommonRange<decltype(s)>);
+		CHECK_EQUAL(s, {1, 3, 5, 7});
+		CHECK(*--s.end() == 7);
+		CHECK_EQUAL(s | view::reverse, {7, 5, 3, 1});
+
+		std::forward_list<int> fl{1, 2, 3, 4, 5};
+		auto f = fl | view::stride(2);
+		static_assert(ForwardRange<decltype(f)>);
+		static_assert(CommonRange<decltype(f)>);
+		CHECK_EQUAL(f, {1, 3, 5});
+		CHECK(count(f, 3) == 1);
+	}
+
+	{
+		std::istringstream sin{"1 2 3 4 5 6 7"};
+		auto s = view::istream<int>(sin) | view::stride(3);
+		static_assert(InputRange<decltype(s)>);
+		static_assert(!ForwardRange<decltype(s)>);
+		CHECK_EQUAL(s, {1, 4, 7});
+	}
+
+	{
+		// Strided copies out of contiguous storage take the gather path.
+		std::vector<double> v(103);
+		for (int i = 0; i < 103; ++i) v[i] = i;
+		std::vector<double> out(21, -1.0);
+		auto s = ext::make_span(v) | view::stride(5);
+		static_assert(detail::StridedCopyable<iterator_t<decltype(s)>, double*>);
+		auto r = copy(s, out.begin());
+		CHECK(r.in == s.end());
+		CHECK(r.out == out.end());
+		for (int i = 0; i < 21; ++i) CHECK(out[i] == 5.0 * i);
+
+		std::vector<long> l;
+		copy(v | view::stride(10), back_inserter(l));
+		CHECK_EQUAL(l, {0, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100});
+
+		int a[7] = {1, 2, 3, 4, 5, 6, 7};
+		int b[3] = {};
+		auto ra = copy(view::stride(a, 3), b);
+		CHECK(ra.out == b + 3);
+		CHECK_EQUAL(b, {1, 4, 7});
+
+		auto part = view::stride(a, 2);
+		int c[2] = {};
+		copy(part.begin() + 1, part.begin() + 3, c);
+		CHECK_EQUAL(c, {3, 5});
+	}
+
+	{
+		auto s = view::iota(0, 9) | view::stride(3)
+			| view::ext::take_while([](int i) { return i < 5; });
+		CHECK_EQUAL(s, {0, 3});
+	}
+
+	return ::test_result();
+}
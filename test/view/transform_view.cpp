@@ -12,6 +12,7 @@
 #include <stl2/view/transform.hpp>
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <stl2/detail/algorithm/count.hpp>
@@ -65,5 +66,68 @@ int main() {
 		view::iota(0) | view::filter(id) | view::transform(id);
 	}
 
+	{
+		// A caching transform invokes its function once per position, even
+		// when filter_view dereferences each position twice.
+		int calls = 0;
+		auto decode = [&calls](int i) { ++calls; return std::to_string(i * i); };
+		auto twice = rgi | view::transform(decode)
+			| view::filter([](const std::string& s) { return s.size() == 2; });
+		CHECK_EQUAL(twice, {"16", "25", "36", "49", "64", "81"});
+		CHECK(calls == 16);
+
+		calls = 0;
+		auto cached = rgi | view::ext::cached_transform(decode);
+		using C = decltype(cached);
+		static_assert(Same<C, ext::cached_transform_view<ref_view<int[10]>, decltype(decode)>>);
+		static_assert(RandomAccessRange<C>);
+		static_assert(SizedRange<C>);
+		static_assert(CommonRange<C>);
+		static_assert(Same<std::string, iter_reference_t<iterator_t<C>>>);
+		auto once = cached
+			| view::filter([](const std::string& s) { return s.size() == 2; });
+		CHECK_EQUAL(once, {"16", "25", "36", "49", "64", "81"});
+		// filter_view hands out a copy of its cached begin, which starts
+		// with an empty cache.
+		CHECK(calls == 11);
+
+		calls = 0;
+		auto i = cached.begin() + 3;
+		CHECK(*i == "16");
+		CHECK(*i == "16");
+		CHECK(calls == 1);
+		auto j = std::move(i);
+		CHECK(*j == "16");
+		CHECK(calls == 1);
+		i = j;
+		CHECK(*i == "16");
+		CHECK(calls == 2);
+		CHECK(*--i == "9");
+		CHECK(*(i += 2) == "25");
+		CHECK(calls == 4);
+		CHECK(*(cached.end() - 1) == "100");
+		CHECK_EQUAL(cached | view::reverse,
+			{"100", "81", "64", "49", "36", "25", "16", "9", "4", "1"});
+
+		auto refs = rgp | view::ext::cached_transform(&std::pair<int,int>::second);
+		static_assert(Same<int &, decltype(*begin(refs))>);
+		CHECK(&*begin(refs) == &rgp[0].second);
+		*++begin(refs) = 42;
+		CHECK(rgp[1].second == 42);
+
+		// Move-only results can't be cached; they take the uncached path.
+		auto box = [](int i) { return std::make_unique<int>(i); };
+		auto boxed = rgi | view::ext::cached_transform(box);
+		static_assert(Same<decltype(boxed),
+			transform_view<ref_view<int[10]>, decltype(box)>>);
+		static_assert(Same<std::unique_ptr<int>,
+			iter_reference_t<iterator_t<decltype(boxed)>>>);
+		auto b = boxed.begin() + 3;
+		CHECK(**b == 4);
+		std::unique_ptr<int> p = *b;
+		CHECK(*p == 4);
+		CHECK(**(boxed.end() - 1) == 10);
+	}
+
 	return ::test_result();
 }
@@ -0,0 +1,139 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/zip.hpp>
+
+#include <algorithm>
+#include <forward_list>
+#include <list>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/reverse.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/algorithm/stable_sort.hpp>
+#include <stl2/view/iota.hpp>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	constexpr auto first = [](auto&& t) -> decltype(auto) { return std::get<0>(t); };
+}
+
+int main() {
+	using namespace ranges;
+
+	{
+		std::vector<int> keys{3, 1, 4, 1, 5, 9, 2, 6};
+		std::vector<std::string> vals{"3", "1a", "4", "1b", "5", "9", "2", "6"};
+		auto z = view::zip(keys, vals);
+		using Z = decltype(z);
+		static_assert(View<Z>);
+		static_assert(RandomAccessRange<Z>);
+		static_assert(SizedRange<Z>);
+		static_assert(CommonRange<Z>);
+		static_assert(RandomAccessRange<const Z>);
+		using I = iterator_t<Z>;
+		static_assert(Same<iter_value_t<I>, std::tuple<int, std::string>>);
+		static_assert(Same<iter_reference_t<I>, ext::common_tuple<int&, std::string&>>);
+		static_assert(Same<iter_rvalue_reference_t<I>,
+			ext::common_tuple<int&&, std::string&&>>);
+		static_assert(Sortable<I>);
+		static_assert(Permutable<I>);
+		CHECK(z.size() == 8u);
+
+		auto [k, v] = *next(z.begin(), 2);
+		CHECK(k == 4);
+		CHECK(v == "4");
+		k = 7;
+		CHECK(keys[2] == 7);
+		keys[2] = 4;
+
+		// Sorting the zipped view sorts both columns in step.
+		CHECK(stable_sort(z, less{}, first) == z.end());
+		CHECK_EQUAL(keys, {1, 1, 2, 3, 4, 5, 6, 9});
+		CHECK(vals == (std::vector<std::string>{"1a", "1b", "2", "3", "4", "5", "6", "9"}));
+		CHECK(sort(z, greater{}) == z.end());
+		CHECK_EQUAL(keys, {9, 6, 5, 4, 3, 2, 1, 1});
+		CHECK(vals == (std::vector<std::string>{"9", "6", "5", "4", "3", "2", "1b", "1a"}));
+		reverse(z);
+		CHECK(vals.front() == "1a");
+		CHECK(keys.back() == 9);
+
+		iter_swap(z.begin(), z.begin() + 7);
+		CHECK(keys.front() == 9);
+		CHECK(vals.front() == "9");
+		std::tuple<int, std::string> t = iter_move(z.begin());
+		CHECK(std::get<1>(t) == "9");
+		CHECK(vals.front().empty());
+		*z.begin() = std::move(t);
+		CHECK(vals.front() == "9");
+	}
+
+	{
+		// As long as the shortest range, and copyable to tuples.
+		std::vector<int> a{1, 2, 3, 4};
+		const std::vector<char> b{'a', 'b', 'c'};
+		auto z = view::zip(a, b, view::iota(10));
+		static_assert(!CommonRange<decltype(z)>);
+		static_assert(RandomAccessRange<decltype(z)>);
+		std::vector<std::tuple<int, char, int>> out(3);
+		auto r = copy(z, out.begin());
+		CHECK(r.out == out.end());
+		CHECK(out[2] == std::make_tuple(3, 'c', 12));
+		CHECK((r.in - z.begin()) == 3);
+		CHECK((z.begin() - r.in) == -3);
+		CHECK(std::get<1>(z.begin()[1]) == 'b');
+
+		auto zz = view::zip(a, b);
+		CHECK(zz.size() == 3u);
+		CHECK((zz.end() - zz.begin()) == 3);
+		CHECK(std::get<0>(*--zz.end()) == 3);
+	}
+
+	{
+		std::forward_list<int> fl{1, 2, 3};
+		std::list<int> l{4, 5, 6, 7};
+		auto z = view::zip(fl, l);
+		static_assert(ForwardRange<decltype(z)>);
+		static_assert(!BidirectionalRange<decltype(z)>);
+		static_assert(CommonRange<decltype(z)>);
+		int n = 0;
+		for (auto [x, y] : z) {
+			CHECK(y == x + 3);
+			++n;
+		}
+		CHECK(n == 3);
+
+		auto zl = view::zip(l, l);
+		static_assert(BidirectionalRange<decltype(zl)>);
+		static_assert(!CommonRange<decltype(zl)>);
+	}
+
+	{
+		std::vector<int> a{1, 2, 3};
+		std::vector<double> b{0.5, 1.5, 2.5, 3.5};
+		auto z = view::zip_with([](int x, double y) { return x * y; }, a, b);
+		static_assert(RandomAccessRange<decltype(z)>);
+		static_assert(SizedRange<decltype(z)>);
+		CHECK_EQUAL(z, {0.5, 3.0, 7.5});
+
+		auto w = view::zip_with([](int& x, int y) -> int& { return x += y; },
+			a, view::iota(0));
+		CHECK(*next(w.begin(), 2) == 5);
+		CHECK_EQUAL(a, {1, 2, 5});
+	}
+
+	return ::test_result();
+}